@@ -7,6 +7,8 @@
 #include <array>
 #include <cstdint>
 #include <fstream>
+#include <map>
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -17,6 +19,8 @@
 #include "openvino/core/model_util.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/core/type/float16.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/compute_hash.hpp"
@@ -303,6 +307,126 @@ public:
         return n;
     }
 };
+
+// The hashes of the constant buffers computed by the previous runs of the pass. An entry is valid while its owner is
+// alive, since the owner keeps the (immutable) buffer at the same address, so the weights shared by the models
+// compiled one after another (e.g. the same mmap'ed file) are hashed once.
+class ConstantHashes {
+public:
+    static ConstantHashes& get() {
+        static ConstantHashes hashes;
+        return hashes;
+    }
+
+    bool find(const void* ptr, size_t size, uint64_t& hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto found = m_entries.find(ptr);
+        if (found == m_entries.end() || found->second.size != size || found->second.owner.expired()) {
+            return false;
+        }
+        hash = found->second.hash;
+        return true;
+    }
+
+    struct Entry {
+        size_t size;
+        std::weak_ptr<ov::Node> owner;
+        uint64_t hash;
+    };
+
+    void insert(const std::vector<std::pair<const void*, Entry>>& entries) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            it = it->second.owner.expired() ? m_entries.erase(it) : std::next(it);
+        }
+        for (const auto& [ptr, entry] : entries) {
+            m_entries[ptr] = entry;
+        }
+    }
+
+private:
+
+    std::mutex m_mutex;
+    std::unordered_map<const void*, Entry> m_entries;
+};
+
+// Collects the constants during the serialization and hashes them concurrently afterwards
+class HashConstantWriter final : public ov::util::ConstantWriter {
+public:
+    HashConstantWriter(std::ostream& bin_data, const std::shared_ptr<ov::Model>& model) : ConstantWriter(bin_data) {
+        collect_owners(model);
+    }
+
+    FilePosition write(const char* ptr,
+                       size_t size,
+                       size_t& new_size,
+                       bool compress_to_fp16,
+                       ov::element::Type src_type,
+                       bool ptr_is_temporary) override {
+        if (compress_to_fp16 || ptr_is_temporary) {
+            // the data doesn't outlive the call
+            return ConstantWriter::write(ptr, size, new_size, compress_to_fp16, src_type, ptr_is_temporary);
+        }
+        new_size = size;
+        m_chunks.emplace_back(ptr, size);
+        // the offset is not known without the binary output, as it is for the base writer
+        return 0;
+    }
+
+    uint64_t compute_data_hash() const {
+        auto& memo = ConstantHashes::get();
+        std::vector<uint64_t> hashes(m_chunks.size());
+        // the tied weights are written several times, the views of a buffer start at the same address
+        std::map<std::pair<const void*, size_t>, size_t> unique;
+        std::vector<size_t> missing;
+        for (size_t i = 0; i < m_chunks.size(); ++i) {
+            const auto& [ptr, size] = m_chunks[i];
+            if (!memo.find(ptr, size, hashes[i]) && unique.emplace(m_chunks[i], i).second) {
+                missing.push_back(i);
+            }
+        }
+
+        ov::parallel_for(missing.size(), [&](size_t i) {
+            const auto& [ptr, size] = m_chunks[missing[i]];
+            hashes[missing[i]] = ov::runtime::compute_hash(ptr, size);
+        });
+
+        std::vector<std::pair<const void*, ConstantHashes::Entry>> entries;
+        for (auto i : missing) {
+            const auto& [ptr, size] = m_chunks[i];
+            if (const auto owner = m_owners.find(ptr); owner != m_owners.end() && owner->second.second == size) {
+                entries.push_back({ptr, {size, owner->second.first, hashes[i]}});
+            }
+        }
+        if (!entries.empty()) {
+            memo.insert(entries);
+        }
+
+        auto seed = get_data_hash();
+        for (size_t i = 0; i < m_chunks.size(); ++i) {
+            const auto found = unique.find(m_chunks[i]);
+            const auto hash = found != unique.end() && found->second != i ? hashes[found->second] : hashes[i];
+            seed = ov::util::u64_hash_combine(seed, hash);
+        }
+        return seed;
+    }
+
+private:
+    void collect_owners(const std::shared_ptr<ov::Model>& model) {
+        for (const auto& op : model->get_ordered_ops()) {
+            if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+                m_owners[constant->get_data_ptr()] = {op, constant->get_byte_size()};
+            } else if (const auto multi_subgraph = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(op)) {
+                for (const auto& body : multi_subgraph->get_functions()) {
+                    collect_owners(body);
+                }
+            }
+        }
+    }
+
+    std::vector<std::pair<const void*, size_t>> m_chunks;
+    std::unordered_map<const void*, std::pair<std::shared_ptr<ov::Node>, size_t>> m_owners;
+};
 }  // namespace
 
 bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& model) {
@@ -314,11 +438,19 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& model) {
 
     // Determinism is important for hash calculation
     // If skip weights set, disable compression to skip internal data hashing
-    auto constant_writer = util::ConstantWriter(bin, !m_skip_weights);
-    serialize_func(xml, bin, model, Serialize::Version::UNSPECIFIED, true, constant_writer);
+    uint64_t data_hash = 0;
+    if (m_skip_weights) {
+        auto constant_writer = util::ConstantWriter(bin, false);
+        serialize_func(xml, bin, model, Serialize::Version::UNSPECIFIED, true, constant_writer);
+        data_hash = constant_writer.get_data_hash();
+    } else {
+        HashConstantWriter constant_writer(bin, model);
+        serialize_func(xml, bin, model, Serialize::Version::UNSPECIFIED, true, constant_writer);
+        data_hash = constant_writer.compute_data_hash();
+    }
 
     auto seed = util::u64_hash_combine(0, xml_hash.get_result());
-    m_hash = util::u64_hash_combine(seed, constant_writer.get_data_hash());
+    m_hash = util::u64_hash_combine(seed, data_hash);
     // Return false because we didn't change OpenVINO Model
     return false;
 }
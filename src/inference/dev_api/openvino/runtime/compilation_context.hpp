@@ -29,7 +29,8 @@ public:
                                     const ov::AnyMap& compile_options);
     static std::string compute_hash(const std::shared_ptr<const ov::Model>& model,
                                     const std::filesystem::path& model_path,
-                                    const ov::AnyMap& compile_options);
+                                    const ov::AnyMap& compile_options,
+                                    bool structural_rt_info = false);
 };
 
 class CompiledBlobHeader final {
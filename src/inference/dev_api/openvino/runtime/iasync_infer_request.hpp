@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <future>
 #include <memory>
 
@@ -21,6 +22,9 @@
 
 namespace ov {
 
+class ISyncInferRequest;
+class LatencyHistograms;
+
 /**
  * @brief Base class with default implementation of asynchronous multi staged inference request.
  *        To customize pipeline stages derived class should change the content
@@ -71,6 +75,34 @@ public:
      */
     virtual void set_callback(std::function<void(std::exception_ptr)> callback);
 
+    /**
+     * @brief Sets the priority of the request. The pipeline stages are passed to the executors with this priority, so
+     * the executors queuing the tasks start the stages of the higher priority requests first.
+     * @param priority The priority of the request
+     */
+    virtual void set_priority(ov::hint::Priority priority);
+
+    /**
+     * @brief Gets the priority of the request
+     * @return The priority of the request, ov::hint::Priority::DEFAULT if it was not set
+     */
+    virtual ov::hint::Priority get_priority() const;
+
+    /**
+     * @brief Forks the states of the source request of the same compiled model into this request, see
+     * ov::InferRequest::fork_states(). The default implementation throws ov::NotImplemented.
+     * @param source The request to fork the states from
+     * @param position Number of the tokens of the KV cache states to keep
+     */
+    virtual void fork_states(const std::shared_ptr<IAsyncInferRequest>& source, size_t position);
+
+    /**
+     * @brief Drops the tokens behind the position from the KV cache states, see ov::InferRequest::trim_states(). The
+     * default implementation throws ov::NotImplemented.
+     * @param position Number of the tokens of the KV cache states to keep
+     */
+    virtual void trim_states(size_t position);
+
     /**
      * @brief Infers specified input(s) in synchronous mode
      * @note blocks all method of InferRequest while request is ongoing (running or waiting in queue)
@@ -269,6 +301,15 @@ private:
         }
     }
 
+    struct LatencyTrace {
+        std::chrono::steady_clock::time_point submitted;
+        std::chrono::steady_clock::time_point started;
+        std::chrono::steady_clock::time_point inputs_prepared;
+        std::chrono::steady_clock::time_point graph_executed;
+        std::chrono::steady_clock::time_point stages_ended;
+    };
+    void record_latencies(const LatencyTrace& trace) const;
+
     std::shared_ptr<IInferRequest> m_sync_request;
 
     std::shared_ptr<ov::threading::ITaskExecutor> m_request_executor;  //!< Used to run inference CPU tasks.
@@ -278,6 +319,11 @@ private:
         m_sync_callback_executor;  //!< Used to run post inference callback in synchronous pipline
     mutable std::mutex m_mutex;
     std::shared_ptr<std::function<void(std::exception_ptr)>> m_callback;
+    ov::hint::Priority m_priority = ov::hint::Priority::DEFAULT;
+
+    std::shared_ptr<ov::LatencyHistograms> m_latency_histograms;  //!< Histograms of the compiled model
+    ISyncInferRequest* m_latency_marks = nullptr;  //!< Sync request which may mark the phases, if any
+    LatencyTrace m_latency_trace;                   //!< Trace of the current inference
 };
 
 }  // namespace ov
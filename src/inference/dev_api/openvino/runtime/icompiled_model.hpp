@@ -18,6 +18,7 @@
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/iremote_context.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/latency_histograms.hpp"
 #include "openvino/runtime/remote_context.hpp"
 #include "openvino/runtime/so_ptr.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
@@ -140,6 +141,13 @@ public:
      */
     virtual void release_memory();
 
+    /**
+     * @brief Gets the latency histograms the infer requests of the compiled model record their inferences to
+     *
+     * @return Latency histograms
+     */
+    virtual std::shared_ptr<ov::LatencyHistograms> get_latency_histograms() const;
+
     virtual ~ICompiledModel();
 
 private:
@@ -148,6 +156,7 @@ private:
     std::vector<ov::Output<const ov::Node>> m_outputs;
     ov::SoPtr<IRemoteContext> m_context;
     std::shared_ptr<const void> m_weight_context;
+    std::shared_ptr<ov::LatencyHistograms> m_latency_histograms = std::make_shared<ov::LatencyHistograms>();
 
     std::shared_ptr<ov::threading::ITaskExecutor> m_task_executor = nullptr;      //!< Holds a task executor
     std::shared_ptr<ov::threading::ITaskExecutor> m_callback_executor = nullptr;  //!< Holds a callback executor
@@ -61,6 +61,43 @@ static constexpr Property<std::string, PropertyMutability::WO> config_device_id{
  */
 static constexpr Property<int32_t, PropertyMutability::RW> threads_per_stream{"THREADS_PER_STREAM"};
 
+/**
+ * @brief Makes CPUStreamsExecutor queue the tasks per stream instead of a single queue: a task is bound to a stream on
+ * submission (the tasks submitted from a stream stay with it) and the idle streams steal the tasks queued for the other
+ * streams of the same NUMA node.
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> streams_work_stealing{"STREAMS_WORK_STEALING"};
+
+/**
+ * @brief Time in milliseconds after which a task queued by CPUStreamsExecutor is started ahead of the tasks of a higher
+ * priority (see ov::InferRequest::set_priority()), so the low priority requests are not starved. 0 (default) means the
+ * priorities are strict.
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> streams_starvation_timeout{"STREAMS_STARVATION_TIMEOUT"};
+
+/**
+ * @brief Statistics of a stream of CPUStreamsExecutor collected since the executor creation
+ * @ingroup ov_dev_api_plugin_api
+ */
+struct StreamStatistics {
+    uint64_t queue_depth = 0;         //!< The number of the tasks queued for the stream (for all the streams if the
+                                      //!< tasks share a single queue)
+    uint64_t max_queue_depth = 0;     //!< The maximum of queue_depth
+    uint64_t tasks = 0;               //!< The number of the tasks executed by the stream
+    uint64_t stolen_tasks = 0;        //!< The number of the tasks stolen from the other streams
+    uint64_t total_wait_time_us = 0;  //!< The total time the executed tasks spent in the queue
+    uint64_t max_wait_time_us = 0;    //!< The maximum time an executed task spent in the queue
+};
+
+/**
+ * @brief Read-only property to get the statistics of the streams executing the infer requests of a compiled model
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<std::vector<StreamStatistics>, PropertyMutability::RO> streams_statistics{
+    "STREAMS_STATISTICS"};
+
 /**
  * @brief It contains compiled_model_runtime_properties information to make plugin runtime can check whether it is
  * compatible with the cached compiled model, the result is returned by get_property() calling.
@@ -100,6 +137,70 @@ static constexpr Property<bool, PropertyMutability::RW> enable_lp_transformation
  */
 static constexpr Property<uint32_t, PropertyMutability::RO> cache_header_alignment{"CACHE_HEADER_ALIGNMENT"};
 
+/**
+ * @brief Write-only property to identify a model in the compilation cache by a structural fingerprint: the runtime info
+ * of the operations, which is not serialized, contributes to the model hash by the attribute names only instead of
+ * their printed values. It makes the hash computation cheaper for the models with a rich runtime info, but the models
+ * differing only in the values of such attributes share the cache entry.
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<bool, PropertyMutability::WO> cache_structural_hash{"CACHE_STRUCTURAL_HASH"};
+
+/**
+ * @brief Limits the total size (in bytes) of the blobs in the cache directory. When a new blob exceeds the limit, the
+ * core evicts the least recently used blobs. 0 (default) means no limit.
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cache_max_size{"CACHE_MAX_SIZE"};
+
+/**
+ * @brief Limits the number of the blobs in the cache directory the same way as cache_max_size. 0 (default) means no
+ * limit.
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cache_max_entries{"CACHE_MAX_ENTRIES"};
+
+/**
+ * @brief Statistics of the cache directory collected since its cache manager creation
+ * @ingroup ov_dev_api_plugin_api
+ */
+struct CacheStatistics {
+    uint64_t hits = 0;        //!< The number of the blobs found in the cache
+    uint64_t misses = 0;      //!< The number of the blobs not found in the cache
+    uint64_t evictions = 0;   //!< The number of the blobs evicted to fit the cache limits
+    uint64_t bytes_read = 0;  //!< The total size of the blobs found in the cache
+};
+
+/**
+ * @brief Read-only property to get the statistics of the cache directory
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<CacheStatistics, PropertyMutability::RO> cache_statistics{"CACHE_STATISTICS"};
+
+/**
+ * @brief Makes the core write the compiled model blob to the cache on a background thread, so compile_model returns
+ * as soon as the model is compiled. The core waits for the pending writes on its destruction. false (default) means
+ * the blob is written before compile_model returns.
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<bool, PropertyMutability::RW> cache_async_write{"CACHE_ASYNC_WRITE"};
+
+/**
+ * @brief Restricts the devices probed by ov::Core::get_available_devices (and so by the virtual devices enumerating
+ * the hardware) to the given device names, the plugins of the other devices are not loaded by the enumeration. Empty
+ * (default) means all the registered devices are probed.
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<std::vector<std::string>, PropertyMutability::RW> probed_devices{"PROBED_DEVICES"};
+
+/**
+ * @brief Read-only property of a compiled model to get the latency histograms of its inferences split into the
+ * phases "QUEUE", "INPUT", "EXECUTION" and "OUTPUT". See ov::LatencyHistograms for the bucket boundaries.
+ * @ingroup ov_dev_api_plugin_api
+ */
+static constexpr Property<std::map<std::string, std::vector<uint64_t>>, PropertyMutability::RO> latency_histograms{
+    "LATENCY_HISTOGRAMS"};
+
 /**
  * @brief Enum to define possible cache quant schema hints.
  */
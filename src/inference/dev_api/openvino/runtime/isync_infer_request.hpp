@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <exception>
 #include <memory>
 #include <unordered_map>
@@ -23,6 +24,8 @@
 
 namespace ov {
 
+class IAsyncInferRequest;
+
 /**
  * @brief Interface for syncronous infer request
  * @ingroup ov_dev_api_sync_infer_request_api
@@ -160,7 +163,23 @@ protected:
     std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, std::vector<ov::SoPtr<ov::ITensor>>> m_batched_tensors;
     ov::SoPtr<ov::ITensor>& get_tensor_ptr(const ov::Output<const ov::Node>& port) const;
 
+    /**
+     * @brief Marks the end of the input preparation of the current inference for the latency histograms of the
+     * compiled model. If it's not marked, the input preparation is accounted in the graph execution.
+     */
+    void mark_inputs_prepared();
+
+    /**
+     * @brief Marks the end of the graph execution of the current inference for the latency histograms of the
+     * compiled model. If it's not marked, the graph execution lasts until the last pipeline stage ends.
+     */
+    void mark_graph_executed();
+
 private:
+    friend class ov::IAsyncInferRequest;
+
+    std::chrono::steady_clock::time_point m_inputs_prepared;
+    std::chrono::steady_clock::time_point m_graph_executed;
     std::shared_ptr<const ov::ICompiledModel> m_compiled_model;
     // Mutable to return reference to ov::Tensor
     mutable std::unordered_map<std::shared_ptr<descriptor::Tensor>,
@@ -0,0 +1,99 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides LatencyHistograms.
+ * @file openvino/runtime/latency_histograms.hpp
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ov {
+
+/**
+ * @brief Histograms of the latencies of the inferences of a compiled model split into the phases. The histograms are
+ * always collected, so a record is a single relaxed atomic increment.
+ *
+ * The bucket 0 counts the latencies below 1 microsecond, the bucket i counts the latencies in [2^(i-1), 2^i)
+ * microseconds, the last bucket also counts all the longer ones.
+ * @ingroup ov_dev_api_plugin_api
+ */
+class LatencyHistograms {
+public:
+    /**
+     * @brief Phases of an inference.
+     */
+    enum class Phase : size_t {
+        QUEUE = 0,      //!< From the submission of the inference until its first pipeline stage starts
+        INPUT = 1,      //!< Input preparation, it's accounted in EXECUTION if a plugin doesn't mark it
+        EXECUTION = 2,  //!< Graph execution
+        OUTPUT = 3,     //!< From the end of the graph execution until the inference is completed, the callback included
+    };
+
+    static constexpr size_t phases = 4;    //!< Number of the phases
+    static constexpr size_t buckets = 32;  //!< Number of the buckets of a histogram
+
+    /**
+     * @brief Gets the name of a phase.
+     * @param phase Phase of an inference.
+     * @return Name of the phase.
+     */
+    static const char* name(Phase phase) {
+        static constexpr const char* names[phases] = {"QUEUE", "INPUT", "EXECUTION", "OUTPUT"};
+        return names[static_cast<size_t>(phase)];
+    }
+
+    /**
+     * @brief Gets the bucket of a latency.
+     * @param latency Latency of a phase.
+     * @return Index of the bucket.
+     */
+    static size_t bucket(std::chrono::steady_clock::duration latency) noexcept {
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+        size_t index = 0;
+        for (; us > 0 && index < buckets - 1; us >>= 1) {
+            ++index;
+        }
+        return index;
+    }
+
+    /**
+     * @brief Records a latency of a phase.
+     * @param phase Phase of an inference.
+     * @param latency Latency of the phase.
+     */
+    void record(Phase phase, std::chrono::steady_clock::duration latency) noexcept {
+        m_counts[static_cast<size_t>(phase)][bucket(latency)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Gets a snapshot of the histograms, the records made meanwhile may be partially included.
+     * @return Bucket counts of each phase by the phase name.
+     */
+    std::map<std::string, std::vector<uint64_t>> get() const {
+        std::map<std::string, std::vector<uint64_t>> histograms;
+        for (size_t phase = 0; phase < phases; ++phase) {
+            auto& histogram = histograms[name(static_cast<Phase>(phase))];
+            histogram.reserve(buckets);
+            for (const auto& count : m_counts[phase]) {
+                histogram.push_back(count.load(std::memory_order_relaxed));
+            }
+        }
+        return histograms;
+    }
+
+private:
+    std::array<std::array<std::atomic<uint64_t>, buckets>, phases> m_counts{};
+};
+
+}  // namespace ov
@@ -11,8 +11,10 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "openvino/runtime/common.hpp"
+#include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 
 namespace ov {
@@ -23,7 +25,9 @@ namespace threading {
  * @ingroup ov_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from single queue, or from the queues of the streams if
+ *        ov::internal::streams_work_stealing is set. The queued tasks of a higher priority are started first,
+ *        ov::internal::streams_starvation_timeout bounds the wait of the lower priority ones.
  */
 class OPENVINO_RUNTIME_API CPUStreamsExecutor : public IStreamsExecutor {
 public:
@@ -45,6 +49,8 @@ public:
 
     void run(Task task) override;
 
+    void run_with_priority(Task task, ov::hint::Priority priority) override;
+
     void execute(Task task) override;
 
     int get_stream_id() override;
@@ -59,6 +65,12 @@ public:
 
     void cpu_reset() override;
 
+    /**
+     * @brief Returns the statistics of the streams collected since the executor creation
+     * @return The statistics of the streams indexed by the stream thread, empty if the executor has no stream threads
+     */
+    std::vector<ov::internal::StreamStatistics> get_statistics() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
@@ -14,6 +14,7 @@
 #include <vector>
 
 #include "openvino/runtime/common.hpp"
+#include "openvino/runtime/properties.hpp"
 
 namespace ov {
 namespace threading {
@@ -62,6 +63,14 @@ public:
      */
     virtual void run(Task task) = 0;
 
+    /**
+     * @brief Execute ov::Task inside task executor context. The executors queuing the tasks start the tasks of a
+     *        higher priority first, the default implementation ignores the priority and calls run()
+     * @param task A task to start
+     * @param priority The priority of the task
+     */
+    virtual void run_with_priority(Task task, ov::hint::Priority priority);
+
     /**
      * @brief Execute all of the tasks and waits for its completion.
      *        Default run_and_wait() method implementation uses run() pure virtual method
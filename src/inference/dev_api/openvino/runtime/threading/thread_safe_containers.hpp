@@ -7,10 +7,16 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <queue>
+#include <thread>
 #include <type_traits>
+#include <utility>
 
+#include "openvino/core/except.hpp"
 #include "openvino/core/parallel.hpp"
 
 #if ((OV_THREAD == OV_THREAD_TBB) || (OV_THREAD == OV_THREAD_TBB_AUTO) || (OV_THREAD == OV_THREAD_TBB_ADAPTIVE))
@@ -21,38 +27,248 @@
 namespace ov {
 namespace threading {
 
+/**
+ * @brief Bounded multi-producer multi-consumer FIFO queue (a ring of the cells tagged by sequence numbers). A producer
+ *        reserves a cell with a single CAS and publishes the value by a release store, so the producers and the
+ *        consumers contend on a shared cache line only when they reserve the same cell.
+ * @note  The queue is not lock-free: try_pop() waits for a cell which is reserved by a producer but not published yet
+ *        rather than reporting the queue empty, so size() elements can always be popped by a single consumer. The cell
+ *        is published even if the construction of the value throws, it's published empty then and skipped by the
+ *        consumers, so they never wait for a producer which has left.
+ * @tparam T The type of the elements, it's not required to be default constructible
+ */
+template <typename T>
+class ThreadSafeRingBuffer {
+public:
+    /**
+     * @brief Constructs the queue
+     * @param capacity The minimal capacity, it's rounded up to a power of 2
+     */
+    explicit ThreadSafeRingBuffer(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _mask = size - 1;
+        _cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i) {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ThreadSafeRingBuffer(const ThreadSafeRingBuffer&) = delete;
+    ThreadSafeRingBuffer& operator=(const ThreadSafeRingBuffer&) = delete;
+
+    /**
+     * @brief Pushes the value if the queue is not full. The value is moved from only if it's pushed.
+     * @return false if the queue is full
+     */
+    template <typename U>
+    bool try_push(U&& value) {
+        auto pos = _enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;) {
+            cell = &_cells[pos & _mask];
+            const auto diff = static_cast<std::intptr_t>(cell->sequence.load(std::memory_order_acquire)) -
+                              static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        try {
+            cell->value.emplace(std::forward<U>(value));
+        } catch (...) {
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            throw;
+        }
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Pops the oldest value
+     * @return false if the queue is empty
+     */
+    bool try_pop(T& value) {
+        for (;;) {
+            const auto [pos, cell] = reserve_published();
+            if (cell == nullptr) {
+                return false;
+            }
+            // the cell is released even if the assignment throws, otherwise the producers would never reuse it
+            const bool empty = !cell->value;
+            try {
+                if (!empty) {
+                    value = std::move(*cell->value);
+                }
+            } catch (...) {
+                release(pos, cell);
+                throw;
+            }
+            release(pos, cell);
+            if (!empty) {
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the number of the pushed (or being pushed) and not popped elements
+     */
+    std::size_t size() const {
+        const auto dequeuePos = _dequeuePos.load(std::memory_order_acquire);
+        const auto enqueuePos = _enqueuePos.load(std::memory_order_acquire);
+        return enqueuePos > dequeuePos ? enqueuePos - dequeuePos : 0;
+    }
+
+    std::size_t capacity() const {
+        return _mask + 1;
+    }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        // empty if the construction of the value has thrown
+        std::optional<T> value;
+    };
+
+    // reserves the oldest published cell, nullptr if the queue is empty
+    std::pair<std::size_t, Cell*> reserve_published() {
+        auto pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell* cell = &_cells[pos & _mask];
+            const auto diff = static_cast<std::intptr_t>(cell->sequence.load(std::memory_order_acquire)) -
+                              static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return {pos, cell};
+                }
+            } else if (diff < 0) {
+                if (_enqueuePos.load(std::memory_order_relaxed) == pos) {
+                    return {pos, nullptr};
+                }
+                // the cell is reserved by a producer which is about to publish the value
+                std::this_thread::yield();
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // makes the popped cell available for the producers of the next round
+    void release(std::size_t pos, Cell* cell) noexcept {
+        cell->value.reset();
+        cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+    }
+
+    // the positions are modified by the producers and the consumers respectively, so they don't share a cache line
+    alignas(64) std::atomic<std::size_t> _enqueuePos{0};
+    alignas(64) std::atomic<std::size_t> _dequeuePos{0};
+    alignas(64) std::size_t _mask = 0;
+    std::unique_ptr<Cell[]> _cells;
+};
+
+/**
+ * @brief Unbounded multi-producer multi-consumer FIFO queue. The elements are queued in the ring buffer, the mutex
+ *        guarded overflow queue is used only while the ring buffer is full.
+ */
 template <typename T>
 class ThreadSafeQueueWithSize {
 public:
+    /**
+     * @brief Constructs the queue
+     * @param capacity The capacity of the ring buffer part of the queue
+     */
+    explicit ThreadSafeQueueWithSize(std::size_t capacity = 1024) : _ring(capacity) {}
+
     void push(T value) {
+        // once the ring buffer overflows the elements go to the overflow queue until it's drained to keep the order
+        if (_overflowSize.load(std::memory_order_acquire) == 0 && _ring.try_push(std::move(value))) {
+            return;
+        }
         std::lock_guard<std::mutex> lock(_mutex);
         _queue.push(std::move(value));
+        _overflowSize.fetch_add(1, std::memory_order_release);
     }
     bool try_pop(T& value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (!_queue.empty()) {
-            value = std::move(_queue.front());
-            _queue.pop();
+        if (_ring.try_pop(value)) {
             return true;
-        } else {
+        }
+        if (_overflowSize.load(std::memory_order_acquire) == 0) {
             return false;
         }
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_queue.empty()) {
+            return false;
+        }
+        value = std::move(_queue.front());
+        _queue.pop();
+        _overflowSize.fetch_sub(1, std::memory_order_release);
+        // the elements move back to the ring buffer while it has space, so the next pops don't take the lock
+        while (!_queue.empty() && _ring.try_push(std::move(_queue.front()))) {
+            _queue.pop();
+            _overflowSize.fetch_sub(1, std::memory_order_release);
+        }
+        return true;
     }
     size_t size() {
-        std::lock_guard<std::mutex> lock(_mutex);
-        return _queue.size();
+        return _ring.size() + _overflowSize.load(std::memory_order_acquire);
     }
 
 protected:
+    ThreadSafeRingBuffer<T> _ring;
     std::queue<T> _queue;
     std::mutex _mutex;
+    std::atomic<std::size_t> _overflowSize{0};
+};
+
+/**
+ * @brief Bounded multi-producer multi-consumer FIFO queue based on the ring buffer. The queue accepts and returns
+ *        nothing until a non-zero capacity is set, setting the zero capacity disables it again.
+ * @note  The ring buffer is allocated by the first non-zero capacity and is never replaced, as the concurrent pushes and
+ *        pops may use it, so the capacity can't grow after it's set.
+ */
+template <typename T>
+class ThreadSafeBoundedQueue {
+public:
+    ThreadSafeBoundedQueue() = default;
+    bool try_push(T value) {
+        return _enabled.load(std::memory_order_acquire) && _ring->try_push(std::move(value));
+    }
+    bool try_pop(T& value) {
+        return _enabled.load(std::memory_order_acquire) && _ring->try_pop(value);
+    }
+    void set_capacity(std::size_t newCapacity) {
+        if (newCapacity != 0) {
+            std::call_once(_ringAllocated, [&] {
+                _ring = std::make_unique<ThreadSafeRingBuffer<T>>(newCapacity);
+            });
+            OPENVINO_ASSERT(_ring->capacity() >= newCapacity,
+                            "The capacity of the bounded queue can't grow from ",
+                            _ring->capacity(),
+                            " to ",
+                            newCapacity);
+        }
+        _enabled.store(newCapacity != 0, std::memory_order_release);
+    }
+
+protected:
+    std::once_flag _ringAllocated;
+    std::unique_ptr<ThreadSafeRingBuffer<T>> _ring;
+    std::atomic_bool _enabled{false};
 };
+
 #if ((OV_THREAD == OV_THREAD_TBB) || (OV_THREAD == OV_THREAD_TBB_AUTO) || (OV_THREAD == OV_THREAD_TBB_ADAPTIVE))
 template <typename T>
 using ThreadSafeQueue = tbb::concurrent_queue<T>;
 template <typename T>
-using ThreadSafeBoundedQueue = tbb::concurrent_bounded_queue<T>;
-template <typename T>
 class ThreadSafeBoundedPriorityQueue {
 public:
     ThreadSafeBoundedPriorityQueue() = default;
@@ -78,37 +294,6 @@ protected:
 template <typename T>
 using ThreadSafeQueue = ThreadSafeQueueWithSize<T>;
 template <typename T>
-class ThreadSafeBoundedQueue {
-public:
-    ThreadSafeBoundedQueue() = default;
-    bool try_push(T value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_capacity) {
-            _queue.push(std::move(value));
-        }
-        return _capacity;
-    }
-    bool try_pop(T& value) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        if (_capacity && !_queue.empty()) {
-            value = std::move(_queue.front());
-            _queue.pop();
-            return true;
-        } else {
-            return false;
-        }
-    }
-    void set_capacity(std::size_t newCapacity) {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _capacity = newCapacity;
-    }
-
-protected:
-    std::queue<T> _queue;
-    std::mutex _mutex;
-    bool _capacity = false;
-};
-template <typename T>
 class ThreadSafeBoundedPriorityQueue {
 public:
     ThreadSafeBoundedPriorityQueue() = default;
@@ -18,6 +18,7 @@
 
 #include "openvino/core/model.hpp"
 #include "openvino/runtime/infer_request.hpp"
+#include "openvino/runtime/infer_request_pool.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/remote_context.hpp"
 
@@ -167,6 +168,15 @@ public:
      */
     InferRequest create_infer_request();
 
+    /**
+     * @brief Creates a pool of the inference requests of the compiled model.
+     * The requests of the pool are created with their input and output tensors up front.
+     *
+     * @param size Number of the requests, the value of ov::optimal_number_of_infer_requests is used if it is 0.
+     * @return InferRequestPool object
+     */
+    InferRequestPool create_infer_request_pool(size_t size = 0);
+
     /**
      * @brief Exports the current compiled model to an output stream `std::ostream`.
      * The exported model can also be imported via the ov::Core::import_model method.
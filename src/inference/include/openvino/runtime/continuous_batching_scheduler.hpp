@@ -0,0 +1,175 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides ContinuousBatchingScheduler.
+ *
+ * @file openvino/runtime/continuous_batching_scheduler.hpp
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/common.hpp"
+
+namespace ov {
+
+class CompiledModel;
+class Model;
+
+/**
+ * @brief Configuration of ov::ContinuousBatchingScheduler.
+ * @ingroup ov_runtime_cpp_api
+ */
+struct ContinuousBatchingConfig {
+    /**
+     * @brief Number of the blocks of the key/value cache of each layer, must be set.
+     */
+    size_t num_kv_blocks = 0;
+
+    /**
+     * @brief Maximum number of the tokens computed by a step, the prompts longer than it are split into chunks.
+     */
+    size_t max_num_batched_tokens = 256;
+
+    /**
+     * @brief Maximum number of the sequences the cache is shared by.
+     */
+    size_t max_num_seqs = 256;
+
+    /**
+     * @brief Token finishing a sequence, none if negative.
+     */
+    int64_t eos_token_id = -1;
+
+    /**
+     * @brief Selects the next token of a sequence from its logits, the most probable token if empty.
+     */
+    std::function<int64_t(const float* logits, size_t vocab_size)> sampler;
+};
+
+/**
+ * @brief Token generated by a step of ov::ContinuousBatchingScheduler.
+ * @ingroup ov_runtime_cpp_api
+ */
+struct GeneratedToken {
+    /**
+     * @brief Request the token is generated for.
+     */
+    uint64_t request_id;
+
+    /**
+     * @brief The token.
+     */
+    int64_t token;
+
+    /**
+     * @brief True if it's the last token of the request.
+     */
+    bool finished;
+};
+
+/**
+ * @brief This is a class of a continuous batching scheduler driving a model transformed by
+ * ov::pass::SDPAToPagedAttention. It owns the key/value cache and its block allocator, so the application only adds
+ * the prompts and collects the generated tokens:
+ * @code
+ * ov::ContinuousBatchingConfig config;
+ * config.num_kv_blocks = 1024;
+ * ov::ContinuousBatchingScheduler scheduler(compiled_model, config);
+ * scheduler.add_request(prompt, 128);
+ * while (scheduler.has_unfinished_requests()) {
+ *     for (const auto& generated : scheduler.step()) {
+ *         // ... stream generated.token of generated.request_id
+ *     }
+ * }
+ * @endcode
+ *
+ * Each step is one inference of a batch mixing the decode tokens of the running sequences with the prompt chunks of
+ * the new ones under the token budget (chunked prefill). The decode tokens are scheduled first. A sequence is admitted
+ * while there are free blocks for its chunk. When the cache runs out of blocks, the most recently admitted sequence
+ * is preempted: its blocks are freed and it is recomputed later.
+ *
+ * The model inputs must be input_ids, position_ids, past_lens, subsequence_begins, block_indices,
+ * block_indices_begins, max_context_len and the key_cache.N / value_cache.N caches, the logits are taken from the
+ * output named logits or the first one.
+ *
+ * ov::pass::SDPAToPagedAttention leaves the type and the shape of the caches dynamic, the device sets them during
+ * the compilation. The CPU plugin does it from ov::key_cache_precision, ov::value_cache_precision,
+ * ov::key_cache_group_size and its block size of 32 tokens. For the devices keeping them dynamic, the model needs
+ * set_cache_shapes() before the compilation. The scheduler takes the cache layout from the compiled model inputs: it
+ * only sets the number of blocks and reads the block size from the dimension 2 of the value caches, as the key caches
+ * quantized by channel keep their scales along that dimension.
+ *
+ * step(), has_unfinished_requests() and free_blocks() are called from one thread, add_request() and abort_request()
+ * may be called concurrently with them.
+ * @ingroup ov_runtime_cpp_api
+ */
+class OPENVINO_RUNTIME_API ContinuousBatchingScheduler {
+    class Impl;
+    std::shared_ptr<Impl> _impl;
+
+public:
+    /**
+     * @brief Sets the type and the shape of the caches of a model transformed by ov::pass::SDPAToPagedAttention
+     * to [blocks, heads, block size, head size], the pre-compilation step for the devices not setting them.
+     * @param model Model transformed by ov::pass::SDPAToPagedAttention.
+     * @param cache_type Floating point type of the caches.
+     * @param block_size Number of the tokens of a block.
+     */
+    static void set_cache_shapes(const std::shared_ptr<Model>& model,
+                                 const element::Type& cache_type,
+                                 size_t block_size);
+
+    /**
+     * @brief Creates the key/value cache and the inference request of the scheduler.
+     * @param compiled_model Compiled model transformed by ov::pass::SDPAToPagedAttention.
+     * @param config Configuration of the scheduler.
+     */
+    ContinuousBatchingScheduler(CompiledModel& compiled_model, const ContinuousBatchingConfig& config);
+
+    /**
+     * @brief Destructor.
+     */
+    ~ContinuousBatchingScheduler();
+
+    /**
+     * @brief Adds a request, which is admitted by the next steps.
+     * @param prompt Tokens of the prompt.
+     * @param max_new_tokens Maximum number of the generated tokens.
+     * @return Identifier of the request.
+     */
+    uint64_t add_request(std::vector<int64_t> prompt, size_t max_new_tokens);
+
+    /**
+     * @brief Drops a request and frees its blocks by the next step.
+     * @param request_id Identifier of the request.
+     */
+    void abort_request(uint64_t request_id);
+
+    /**
+     * @brief Schedules and infers one batch.
+     * @return Tokens generated by the step.
+     */
+    std::vector<GeneratedToken> step();
+
+    /**
+     * @brief Checks if any request is not finished.
+     * @return True if there are requests to step.
+     */
+    bool has_unfinished_requests() const;
+
+    /**
+     * @brief Gets the number of the free blocks of the key/value cache.
+     * @return Number of the blocks.
+     */
+    size_t free_blocks() const;
+};
+
+}  // namespace ov
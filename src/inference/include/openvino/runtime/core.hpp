@@ -10,6 +10,7 @@
 #pragma once
 
 #include <filesystem>
+#include <future>
 #include <istream>
 #include <map>
 #include <memory>
@@ -395,6 +396,55 @@ public:
 #endif
     /// @}
 
+    /**
+     * @brief Creates a compiled model from a source model object on a background thread.
+     *
+     * The calling thread is not blocked by the compilation, so an application may serve the requests with a model
+     * compiled faster (e.g. with fewer optimizations or on another device) and swap in the compiled model once the
+     * future is ready:
+     * @code
+     * auto optimized = core.compile_model_async(model, "GPU");
+     * auto compiled_model = core.compile_model(model, "CPU");
+     * while (serving) {
+     *     if (optimized.valid() && optimized.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+     *         compiled_model = optimized.get();
+     *     }
+     *     // serve the requests with compiled_model
+     * }
+     * @endcode
+     * The compiled models can be used simultaneously, so the requests created from the fallback model may be kept
+     * until completion.
+     *
+     * The compilations run one after another on an executor owned by the core, the returned future doesn't wait for
+     * the compilation on destruction, while the core does. If the model caching is enabled (ov::cache_dir), the
+     * future is ready once the cache blob is written, unless the blob is written asynchronously
+     * (the CACHE_ASYNC_WRITE core property): then the future is ready as soon as the model is compiled and the blob is
+     * written in the background.
+     *
+     * @param model Model object acquired from Core::read_model.
+     * @param device_name Name of a device to load a model to.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return A future of the compiled model, it holds the exception thrown by the compilation if any.
+     */
+    std::future<CompiledModel> compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
+    /**
+     * @brief Reads a model and creates a compiled model from the IR/ONNX/PDPD file on a background thread, see the
+     * overload above.
+     *
+     * @param model_path Path to a model.
+     * @param device_name Name of a device to load a model to.
+     * @param properties Optional map of pairs: (property name, property value) relevant only for this load
+     * operation.
+     * @return A future of the compiled model, it holds the exception thrown by the compilation if any.
+     */
+    std::future<CompiledModel> compile_model_async(const std::filesystem::path& model_path,
+                                                   const std::string& device_name,
+                                                   const AnyMap& properties = {});
+
     /**
      * @brief Reads a model and creates a compiled model from the IR/ONNX/PDPD memory.
      * @param model String with a model in IR/ONNX/PDPD format.
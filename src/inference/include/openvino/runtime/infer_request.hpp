@@ -16,6 +16,7 @@
 #include "openvino/core/node_output.hpp"
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/profiling_info.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/variable_state.hpp"
 
@@ -278,6 +279,40 @@ public:
      */
     void start_async();
 
+    /**
+     * @brief Sets the priority of the request relative to the other requests of the same compiled model.
+     * @note The devices queuing the requests (e.g. CPU with several streams) start the requests of a higher priority
+     *       first, the other devices ignore the priority. The request must not be running.
+     * @param priority Priority of the request, ov::hint::Priority::DEFAULT by default.
+     */
+    void set_priority(ov::hint::Priority priority);
+
+    /**
+     * @brief Gets the priority of the request.
+     * @return Priority of the request.
+     */
+    ov::hint::Priority get_priority() const;
+
+    /**
+     * @brief Forks the states of another infer request of the same compiled model into this request: the KV cache
+     * states keep the first @p position tokens of the source states, the other states are copied.
+     * @note The devices supporting it (e.g. CPU) share the kept tokens with the source until this request writes to
+     *       its states (copy-on-write), so a common prompt is computed once for several requests. The other devices
+     *       throw an exception. Neither request may be running.
+     * @param source Infer request to fork the states from.
+     * @param position Number of the tokens of the KV cache states to keep.
+     */
+    void fork_states(const InferRequest& source, size_t position);
+
+    /**
+     * @brief Drops the tokens behind @p position from the KV cache states in place, e.g. the draft tokens rejected by
+     * the verification of speculative decoding, so the next inference continues from the position.
+     * @note The other states are kept as is. The devices not supporting it throw an exception. The request must not
+     *       be running.
+     * @param position Number of the tokens of the KV cache states to keep.
+     */
+    void trim_states(size_t position);
+
     /**
      * @brief Waits for the result to become available. Blocks until the result
      * becomes available.
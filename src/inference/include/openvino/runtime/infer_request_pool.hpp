@@ -0,0 +1,140 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file that provides InferRequestPool.
+ *
+ * @file openvino/runtime/infer_request_pool.hpp
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "openvino/core/node_output.hpp"
+#include "openvino/runtime/common.hpp"
+#include "openvino/runtime/infer_request.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+
+class CompiledModel;
+
+/**
+ * @brief This is a class of a pool of inference requests of a compiled model created up front with their input and
+ * output tensors, so serving doesn't create requests or allocate tensors in the steady state.
+ *
+ * The pool is created by ov::CompiledModel::create_infer_request_pool(). The copies of the pool object share the
+ * requests. The requests are acquired for an inference and released back to the pool afterwards:
+ * @code
+ * auto pool = compiled_model.create_infer_request_pool();
+ * auto request = pool.acquire();
+ * request.set_input_tensor(input);
+ * request.infer();
+ * auto output = pool.take_output_tensor(request, compiled_model.output());  // the output outlives the request use
+ * pool.release(std::move(request));
+ * // ... consume the output
+ * pool.recycle_output_tensor(compiled_model.output(), std::move(output));
+ * @endcode
+ * @ingroup ov_runtime_cpp_api
+ */
+class OPENVINO_RUNTIME_API InferRequestPool {
+    class Impl;
+    std::shared_ptr<Impl> _impl;
+
+    /**
+     * @brief Creates the requests of the pool.
+     * @param compiled_model Compiled model to create the requests of.
+     * @param size Number of the requests, ov::optimal_number_of_infer_requests of the model if 0.
+     */
+    InferRequestPool(CompiledModel& compiled_model, size_t size);
+    friend class ov::CompiledModel;
+
+public:
+    /**
+     * @brief Default constructor.
+     */
+    InferRequestPool() = default;
+
+    /**
+     * @brief Default copy constructor.
+     * @param other Another InferRequestPool object.
+     */
+    InferRequestPool(const InferRequestPool& other) = default;
+
+    /**
+     * @brief Default copy assignment operator.
+     * @param other Another InferRequestPool object.
+     * @return Reference to the current object.
+     */
+    InferRequestPool& operator=(const InferRequestPool& other) = default;
+
+    /**
+     * @brief Default move constructor.
+     * @param other Another InferRequestPool object.
+     */
+    InferRequestPool(InferRequestPool&& other) = default;
+
+    /**
+     * @brief Default move assignment operator.
+     * @param other Another InferRequestPool object.
+     * @return Reference to the current object.
+     */
+    InferRequestPool& operator=(InferRequestPool&& other) = default;
+
+    /**
+     * @brief Destructor. The acquired requests stay valid.
+     */
+    ~InferRequestPool();
+
+    /**
+     * @brief Acquires an idle request, blocks until a request is released if all of them are in use.
+     * @return Request which must be released back by release().
+     */
+    InferRequest acquire();
+
+    /**
+     * @brief Acquires an idle request if any.
+     * @param request Acquired request.
+     * @return True if a request was acquired.
+     */
+    bool try_acquire(InferRequest& request);
+
+    /**
+     * @brief Returns a request acquired from the pool back to it.
+     * @note The request must not be running.
+     * @param request Request acquired from the pool.
+     */
+    void release(InferRequest request);
+
+    /**
+     * @brief Hands out the output tensor of a request without copying it, the request gets another tensor for the
+     * output (a recycled one if any), so the handed out tensor is not overwritten by the next inferences.
+     * @param request Request acquired from the pool.
+     * @param port Output of the compiled model.
+     * @return Output tensor, which may be returned to the pool by recycle_output_tensor() once it's consumed.
+     */
+    Tensor take_output_tensor(InferRequest& request, const ov::Output<const ov::Node>& port);
+
+    /**
+     * @brief Returns a tensor handed out by take_output_tensor() to the pool for the reuse.
+     * @param port Output of the compiled model the tensor was taken for.
+     * @param tensor Tensor which is not used anymore.
+     */
+    void recycle_output_tensor(const ov::Output<const ov::Node>& port, Tensor tensor);
+
+    /**
+     * @brief Gets the number of the requests of the pool.
+     * @return Number of the requests.
+     */
+    size_t size() const;
+
+    /**
+     * @brief Gets the number of the idle requests.
+     * @return Number of the requests which may be acquired without waiting.
+     */
+    size_t available() const;
+};
+
+}  // namespace ov
@@ -20,17 +20,25 @@ CacheGuardEntry::CacheGuardEntry(CacheGuard& cacheGuard,
 
 CacheGuardEntry::~CacheGuardEntry() {
     m_refCount--;
-    m_mutex->unlock();
+    if (m_locked) {
+        m_mutex->unlock();
+    }
     m_cacheGuard.check_for_remove(m_hash);
 }
 
 void CacheGuardEntry::perform_lock() {
     m_mutex->lock();
+    m_locked = true;
+}
+
+bool CacheGuardEntry::try_perform_lock() {
+    m_locked = m_mutex->try_lock();
+    return m_locked;
 }
 
 //////////////////////////////////////////////////////
 
-std::unique_ptr<CacheGuardEntry> CacheGuard::get_hash_lock(const std::string& hash) {
+std::unique_ptr<CacheGuardEntry> CacheGuard::create_entry(const std::string& hash) {
     std::unique_ptr<CacheGuardEntry> res;
     {
         std::unique_lock<std::mutex> lock(m_tableMutex);
@@ -47,10 +55,23 @@ std::unique_ptr<CacheGuardEntry> CacheGuard::get_hash_lock(const std::string& ha
             throw;
         }
     }
+    return res;
+}
+
+std::unique_ptr<CacheGuardEntry> CacheGuard::get_hash_lock(const std::string& hash) {
+    auto res = create_entry(hash);
     res->perform_lock();  // in case of exception, 'res' will be destroyed and item will be cleaned up from table
     return res;
 }
 
+std::unique_ptr<CacheGuardEntry> CacheGuard::try_get_hash_lock(const std::string& hash) {
+    auto res = create_entry(hash);
+    if (!res->try_perform_lock()) {
+        res.reset();  // the item will be cleaned up from table if it is not used
+    }
+    return res;
+}
+
 void CacheGuard::check_for_remove(const std::string& hash) {
     std::lock_guard<std::mutex> lock(m_tableMutex);
     if (m_table.count(hash)) {
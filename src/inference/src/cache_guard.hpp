@@ -60,11 +60,20 @@ public:
      */
     void perform_lock();
 
+    /**
+     * @brief Tries to lock associated mutex without blocking
+     *
+     * @note Will be called only by CacheGuard, it shall not be called from client's code
+     * @return true if the mutex is locked
+     */
+    bool try_perform_lock();
+
 private:
     CacheGuard& m_cacheGuard;
     std::string m_hash;
     std::shared_ptr<std::mutex> m_mutex;
     std::atomic_int& m_refCount;
+    bool m_locked = false;
 };
 
 /**
@@ -94,6 +103,15 @@ public:
      */
     std::unique_ptr<CacheGuardEntry> get_hash_lock(const std::string& hash);
 
+    /**
+     * @brief Same as get_hash_lock(), but doesn't wait if any other thread holds a lock to same hash
+     *
+     * @param hash String representing hash of network
+     *
+     * @return RAII pointer to CacheGuardEntry or nullptr if the cache entry is locked by another thread
+     */
+    std::unique_ptr<CacheGuardEntry> try_get_hash_lock(const std::string& hash);
+
     /**
      * @brief Checks whether there is any clients holding the lock after CacheGuardEntry deletion
      * It will be called on destruction of CacheGuardEntry and shall not be used directly by client's code
@@ -106,6 +124,8 @@ public:
     void check_for_remove(const std::string& hash);
 
 private:
+    std::unique_ptr<CacheGuardEntry> create_entry(const std::string& hash);
+
     struct Item {
         std::shared_ptr<std::mutex> m_mutexPtr{std::make_shared<std::mutex>()};
         // Reference counter for item usage
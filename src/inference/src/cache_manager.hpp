@@ -9,13 +9,19 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <functional>
 #include <string>
+#include <system_error>
 #include <variant>
+#include <vector>
 
 #include "openvino/runtime/icache_manager.hpp"
+#include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/util/file_util.hpp"
@@ -29,9 +35,17 @@ namespace ov {
  *
  * Uses simple file for read/write cached models.
  *
+ * The directory may be bounded by the total size and the number of the blobs. The last access time of a blob is its
+ * modification time, which is updated on each read, so the access order is shared by all the processes using the
+ * directory and survives restarts. The manager doesn't evict anything itself: the caller (the core) asks for the
+ * least recently used blobs exceeding the limits and evicts the ones it can lock.
  */
 class FileStorageCacheManager final : public ICacheManager {
     std::filesystem::path m_cache_path;
+    std::atomic<uint64_t> m_hits{0};
+    std::atomic<uint64_t> m_misses{0};
+    std::atomic<uint64_t> m_evictions{0};
+    std::atomic<uint64_t> m_bytes_read{0};
 
     std::filesystem::path get_blob_file(const std::string& blob_hash) const {
         return m_cache_path / (blob_hash + ".blob");
@@ -46,6 +60,77 @@ public:
         util::create_directory_recursive(m_cache_path);
     }
 
+    /**
+     * @brief Returns the blobs to evict to fit the limits, the least recently used go first
+     *
+     * @param keep_id The blob which is never evicted, e.g. the one just written
+     * @param max_size The total size of the blobs in bytes, 0 means no limit
+     * @param max_entries The number of the blobs, 0 means no limit
+     */
+    std::vector<std::string> get_eviction_candidates(const std::string& keep_id,
+                                                     uint64_t max_size,
+                                                     uint64_t max_entries) const {
+        if (max_size == 0 && max_entries == 0) {
+            return {};
+        }
+
+        struct Blob {
+            std::string id;
+            uintmax_t size;
+            std::filesystem::file_time_type access_time;
+        };
+        std::vector<Blob> blobs;
+        uintmax_t total_size = 0;
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(m_cache_path, ec)) {
+            if (entry.path().extension() != ".blob" || !entry.is_regular_file(ec)) {
+                continue;
+            }
+            const auto size = entry.file_size(ec);
+            if (ec) {
+                continue;
+            }
+            const auto access_time = entry.last_write_time(ec);
+            if (ec) {
+                continue;
+            }
+            blobs.push_back({util::path_to_string(entry.path().stem()), size, access_time});
+            total_size += size;
+        }
+        std::sort(blobs.begin(), blobs.end(), [](const Blob& lhs, const Blob& rhs) {
+            return lhs.access_time < rhs.access_time;
+        });
+
+        std::vector<std::string> candidates;
+        auto num_entries = blobs.size();
+        for (const auto& blob : blobs) {
+            if ((max_size == 0 || total_size <= max_size) && (max_entries == 0 || num_entries <= max_entries)) {
+                break;
+            }
+            if (blob.id == keep_id) {
+                continue;
+            }
+            candidates.push_back(blob.id);
+            total_size -= blob.size;
+            --num_entries;
+        }
+        return candidates;
+    }
+
+    /**
+     * @brief Removes the blob to fit the limits, the caller is responsible for locking it
+     */
+    void evict_cache_entry(const std::string& id) {
+        std::error_code ec;
+        if (std::filesystem::remove(get_blob_file(id), ec)) {
+            ++m_evictions;
+        }
+    }
+
+    ov::internal::CacheStatistics get_statistics() const {
+        return {m_hits, m_misses, m_evictions, m_bytes_read};
+    }
+
 private:
     void write_cache_entry(const std::string& id, StreamWriter writer) override {
         // Fix the bug caused by pugixml, which may return unexpected results if the locale is different from "C".
@@ -72,6 +157,13 @@ private:
         ScopedLocale plocal_C(LC_ALL, "C");
         const auto blob_path = get_blob_file(id);
         if (ov::util::file_exists(blob_path)) {
+            std::error_code ec;
+            ++m_hits;
+            if (const auto size = std::filesystem::file_size(blob_path, ec); !ec) {
+                m_bytes_read += size;
+            }
+            // the modification time is the last access time for the eviction
+            std::filesystem::last_write_time(blob_path, std::filesystem::file_time_type::clock::now(), ec);
             if (enable_mmap) {
                 CompiledBlobVariant compiled_blob{std::in_place_index<0>, ov::read_tensor_data(blob_path)};
                 reader(compiled_blob);
@@ -81,6 +173,8 @@ private:
                 CompiledBlobVariant compiled_blob{std::in_place_index<1>, std::ref(stream)};
                 reader(compiled_blob);
             }
+        } else {
+            ++m_misses;
         }
     }
 
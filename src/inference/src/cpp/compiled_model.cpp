@@ -6,6 +6,7 @@
 
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
+#include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
 
 #define OV_COMPILED_MODEL_CALL_STATEMENT(...)                 \
@@ -128,6 +129,11 @@ InferRequest CompiledModel::create_infer_request() {
     OV_COMPILED_MODEL_CALL_STATEMENT(return {_impl->create_infer_request(), _so});
 }
 
+InferRequestPool CompiledModel::create_infer_request_pool(size_t size) {
+    OPENVINO_ASSERT(_impl != nullptr, "CompiledModel was not initialized.");
+    return {*this, size};
+}
+
 void CompiledModel::export_model(std::ostream& networkModel) {
     OV_COMPILED_MODEL_CALL_STATEMENT(_impl->export_model(networkModel));
 }
@@ -138,6 +144,10 @@ void CompiledModel::set_property(const AnyMap& config) {
 
 Any CompiledModel::get_property(const std::string& name) const {
     OV_COMPILED_MODEL_CALL_STATEMENT({
+        // the histograms are collected by the infer requests of any plugin, so the property isn't routed to them
+        if (name == ov::internal::latency_histograms.name()) {
+            return Any{_impl->get_latency_histograms()->get()};
+        }
         auto property = _impl->get_property(name);
         if (!property._so)
             property._so = _so;
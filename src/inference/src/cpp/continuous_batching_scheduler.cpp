@@ -0,0 +1,476 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/continuous_batching_scheduler.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/core/node_output.hpp"
+#include "openvino/op/paged_attention.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/infer_request.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+namespace ov {
+
+namespace {
+
+struct Sequence {
+    uint64_t id;
+    // the prompt followed by the generated tokens
+    std::vector<int64_t> tokens;
+    size_t prompt_len;
+    size_t max_new_tokens;
+    // number of the tokens in the cache
+    size_t processed = 0;
+    std::vector<int32_t> blocks;
+    // number of the tokens scheduled by the current step
+    size_t scheduled = 0;
+};
+
+bool has_name(const ov::Output<const ov::Node>& port, const std::string& name) {
+    return port.get_names().count(name) != 0;
+}
+
+bool has_name_prefix(const ov::Output<const ov::Node>& port, const std::string& prefix) {
+    const auto& names = port.get_names();
+    return std::any_of(names.begin(), names.end(), [&](const std::string& name) {
+        return name.compare(0, prefix.size(), prefix) == 0;
+    });
+}
+
+void write(Tensor& tensor, const std::vector<int64_t>& values) {
+    if (tensor.get_element_type() == element::i64) {
+        std::copy(values.begin(), values.end(), tensor.data<int64_t>());
+    } else {
+        OPENVINO_ASSERT(tensor.get_element_type() == element::i32,
+                        "ContinuousBatchingScheduler doesn't support the input of type ",
+                        tensor.get_element_type());
+        std::transform(values.begin(), values.end(), tensor.data<int32_t>(), [](int64_t value) {
+            return static_cast<int32_t>(value);
+        });
+    }
+}
+
+int64_t argmax(const float* logits, size_t vocab_size) {
+    return static_cast<int64_t>(std::max_element(logits, logits + vocab_size) - logits);
+}
+
+}  // namespace
+
+class ContinuousBatchingScheduler::Impl {
+public:
+    Impl(CompiledModel& compiled_model, const ContinuousBatchingConfig& config)
+        : m_config{config},
+          m_request{compiled_model.create_infer_request()} {
+        OPENVINO_ASSERT(m_config.num_kv_blocks > 0, "ContinuousBatchingScheduler requires the number of KV blocks");
+        OPENVINO_ASSERT(m_config.max_num_batched_tokens > 0 && m_config.max_num_seqs > 0,
+                        "ContinuousBatchingScheduler requires non-zero token budget and sequences number");
+
+        for (const auto& input : compiled_model.inputs()) {
+            const bool value_cache = has_name_prefix(input, "value_cache.");
+            if (value_cache || has_name_prefix(input, "key_cache.")) {
+                auto shape = input.get_partial_shape();
+                OPENVINO_ASSERT(shape.rank().is_static() && shape.size() == 4 && input.get_element_type().is_static(),
+                                "ContinuousBatchingScheduler requires the cache ",
+                                input.get_any_name(),
+                                " of a static type and rank 4, got ",
+                                input.get_element_type(),
+                                " ",
+                                shape,
+                                ". Call ContinuousBatchingScheduler::set_cache_shapes() before the compilation");
+                shape[0] = static_cast<int64_t>(m_config.num_kv_blocks);
+                OPENVINO_ASSERT(shape.is_static(),
+                                "ContinuousBatchingScheduler requires the cache ",
+                                input.get_any_name(),
+                                " of static shape except the number of blocks, got ",
+                                input.get_partial_shape());
+                // the key caches quantized by channel extend the block dimension by the scales
+                if (value_cache) {
+                    const auto block_size = static_cast<size_t>(shape[2].get_length());
+                    OPENVINO_ASSERT(m_block_size == 0 || m_block_size == block_size,
+                                    "ContinuousBatchingScheduler requires the same block size of the caches, got ",
+                                    m_block_size,
+                                    " and ",
+                                    block_size);
+                    m_block_size = block_size;
+                }
+                m_request.set_tensor(input, Tensor(input.get_element_type(), shape.to_shape()));
+                continue;
+            }
+            bool found = false;
+            for (auto& [name, port] : m_inputs) {
+                if (has_name(input, name)) {
+                    port = input;
+                    found = true;
+                }
+            }
+            OPENVINO_ASSERT(found,
+                            "ContinuousBatchingScheduler doesn't support the model input ",
+                            input.get_any_name());
+        }
+        OPENVINO_ASSERT(m_block_size > 0, "ContinuousBatchingScheduler requires the value_cache.N model inputs");
+        for (const auto& [name, port] : m_inputs) {
+            OPENVINO_ASSERT(port.get_node() || name == "position_ids",
+                            "ContinuousBatchingScheduler requires the model input ",
+                            name);
+        }
+
+        const auto& outputs = compiled_model.outputs();
+        const auto logits = std::find_if(outputs.begin(), outputs.end(), [](const ov::Output<const ov::Node>& port) {
+            return has_name(port, "logits");
+        });
+        m_logits = logits != outputs.end() ? *logits : compiled_model.output(0);
+
+        // the blocks are reused in the LIFO order, so the recently freed ones are likely in the cache
+        m_free_blocks.resize(m_config.num_kv_blocks);
+        for (size_t i = 0; i < m_config.num_kv_blocks; i++) {
+            m_free_blocks[i] = static_cast<int32_t>(m_config.num_kv_blocks - 1 - i);
+        }
+    }
+
+    uint64_t add_request(std::vector<int64_t> prompt, size_t max_new_tokens) {
+        OPENVINO_ASSERT(!prompt.empty() && max_new_tokens > 0,
+                        "ContinuousBatchingScheduler requires a non-empty prompt and generated tokens");
+        OPENVINO_ASSERT(prompt.size() + max_new_tokens <= m_config.num_kv_blocks * m_block_size,
+                        "ContinuousBatchingScheduler request of ",
+                        prompt.size() + max_new_tokens,
+                        " tokens doesn't fit the cache of ",
+                        m_config.num_kv_blocks * m_block_size,
+                        " tokens");
+        const auto prompt_len = prompt.size();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_added.push_back({m_next_id++, std::move(prompt), prompt_len, max_new_tokens, 0, {}, 0});
+        return m_added.back().id;
+    }
+
+    void abort_request(uint64_t request_id) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_aborted.insert(request_id);
+    }
+
+    std::vector<GeneratedToken> step() {
+        take_added_and_aborted();
+        std::vector<Sequence*> batch = schedule();
+        if (batch.empty()) {
+            return {};
+        }
+        infer(batch);
+        return sample(batch);
+    }
+
+    bool has_unfinished_requests() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return !m_running.empty() || !m_waiting.empty() || !m_added.empty();
+    }
+
+    size_t free_blocks() const {
+        return m_free_blocks.size();
+    }
+
+private:
+    void take_added_and_aborted() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& sequence : m_added) {
+            m_waiting.push_back(std::move(sequence));
+        }
+        m_added.clear();
+        if (m_aborted.empty()) {
+            return;
+        }
+        for (auto it = m_running.begin(); it != m_running.end();) {
+            if (m_aborted.count(it->id)) {
+                release_blocks(*it);
+                it = m_running.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        m_waiting.erase(std::remove_if(m_waiting.begin(),
+                                       m_waiting.end(),
+                                       [&](const Sequence& sequence) {
+                                           return m_aborted.count(sequence.id) != 0;
+                                       }),
+                        m_waiting.end());
+        m_aborted.clear();
+    }
+
+    void release_blocks(Sequence& sequence) {
+        m_free_blocks.insert(m_free_blocks.end(), sequence.blocks.rbegin(), sequence.blocks.rend());
+        sequence.blocks.clear();
+    }
+
+    // number of the tokens the sequence may take with its blocks and the free ones
+    size_t capacity(const Sequence& sequence) const {
+        return (sequence.blocks.size() + m_free_blocks.size()) * m_block_size - sequence.processed;
+    }
+
+    void allocate_blocks(Sequence& sequence) {
+        const auto tokens = sequence.processed + sequence.scheduled;
+        while (sequence.blocks.size() * m_block_size < tokens) {
+            sequence.blocks.push_back(m_free_blocks.back());
+            m_free_blocks.pop_back();
+        }
+    }
+
+    // recomputation: the sequence drops its cache and is admitted again with its generated tokens as the prompt
+    void preempt(std::list<Sequence>::iterator it) {
+        release_blocks(*it);
+        it->processed = 0;
+        it->scheduled = 0;
+        m_waiting.push_front(std::move(*it));
+        m_running.erase(it);
+    }
+
+    std::vector<Sequence*> schedule() {
+        size_t budget = m_config.max_num_batched_tokens;
+        std::vector<Sequence*> batch;
+        size_t preempted = 0;
+
+        // the decode tokens go first, so the prompts don't stall the generation, then the remaining prompt chunks
+        for (const bool decode : {true, false}) {
+            for (auto it = m_running.begin(); it != m_running.end() && budget > 0;) {
+                auto& sequence = *it;
+                const size_t remaining = sequence.tokens.size() - sequence.processed;
+                if (sequence.scheduled > 0 || (remaining == 1) != decode) {
+                    ++it;
+                    continue;
+                }
+                // the sequences admitted after it and not scheduled yet give their blocks up, the most recent first
+                while (capacity(sequence) == 0) {
+                    const auto newer = std::make_reverse_iterator(std::next(it));
+                    auto victim = std::find_if(m_running.rbegin(), newer, [](const Sequence& other) {
+                        return other.scheduled == 0;
+                    });
+                    if (victim == newer) {
+                        break;
+                    }
+                    preempt(std::prev(victim.base()));
+                    preempted++;
+                }
+                if (capacity(sequence) == 0) {
+                    // the newer sequences are scheduled, so it is the most recently admitted one to give its blocks up
+                    preempt(it++);
+                    preempted++;
+                    continue;
+                }
+                sequence.scheduled = std::min({remaining, budget, capacity(sequence)});
+                allocate_blocks(sequence);
+                budget -= sequence.scheduled;
+                batch.push_back(&sequence);
+                ++it;
+            }
+        }
+
+        // the sequences preempted by this step wait for the next one instead of recomputing into the blocks they freed
+        while (preempted == 0 && budget > 0 && m_running.size() < m_config.max_num_seqs && !m_waiting.empty()) {
+            auto& sequence = m_waiting.front();
+            const size_t scheduled = std::min({sequence.tokens.size(), budget, capacity(sequence)});
+            if (scheduled == 0) {
+                break;
+            }
+            m_running.push_back(std::move(sequence));
+            m_waiting.pop_front();
+            auto& admitted = m_running.back();
+            admitted.scheduled = scheduled;
+            allocate_blocks(admitted);
+            budget -= scheduled;
+            batch.push_back(&admitted);
+        }
+        return batch;
+    }
+
+    void infer(const std::vector<Sequence*>& batch) {
+        std::vector<int64_t> input_ids, position_ids, past_lens, block_indices;
+        std::vector<int64_t> subsequence_begins{0}, block_indices_begins{0};
+        int64_t max_context_len = 0;
+        for (const auto* sequence : batch) {
+            for (size_t i = sequence->processed; i < sequence->processed + sequence->scheduled; i++) {
+                input_ids.push_back(sequence->tokens[i]);
+                position_ids.push_back(static_cast<int64_t>(i));
+            }
+            past_lens.push_back(static_cast<int64_t>(sequence->processed));
+            subsequence_begins.push_back(static_cast<int64_t>(input_ids.size()));
+            block_indices.insert(block_indices.end(), sequence->blocks.begin(), sequence->blocks.end());
+            block_indices_begins.push_back(static_cast<int64_t>(block_indices.size()));
+            max_context_len =
+                std::max(max_context_len, static_cast<int64_t>(sequence->processed + sequence->scheduled));
+        }
+
+        const std::vector<std::pair<const char*, const std::vector<int64_t>*>> values{
+            {"input_ids", &input_ids},
+            {"position_ids", &position_ids},
+            {"past_lens", &past_lens},
+            {"subsequence_begins", &subsequence_begins},
+            {"block_indices", &block_indices},
+            {"block_indices_begins", &block_indices_begins},
+        };
+        for (const auto& [name, data] : values) {
+            const auto& port = m_inputs.at(name);
+            if (!port.get_node()) {
+                continue;
+            }
+            auto tensor = m_request.get_tensor(port);
+            tensor.set_shape({data->size()});
+            write(tensor, *data);
+        }
+        auto max_context_len_tensor = m_request.get_tensor(m_inputs.at("max_context_len"));
+        max_context_len_tensor.set_shape({});
+        write(max_context_len_tensor, {max_context_len});
+
+        m_request.infer();
+        m_subsequence_begins = std::move(subsequence_begins);
+    }
+
+    std::vector<GeneratedToken> sample(const std::vector<Sequence*>& batch) {
+        const auto logits = m_request.get_tensor(m_logits);
+        OPENVINO_ASSERT(logits.get_element_type() == element::f32 && logits.get_shape().size() > 1,
+                        "ContinuousBatchingScheduler requires f32 logits of the shape [tokens, vocabulary size], got ",
+                        logits.get_element_type(),
+                        " ",
+                        logits.get_shape());
+        const size_t vocab_size = logits.get_shape().back();
+        const size_t rows = logits.get_size() / vocab_size;
+        const size_t tokens = static_cast<size_t>(m_subsequence_begins.back());
+        // the models may compute the logits of the last token of each sequence only
+        OPENVINO_ASSERT(rows == tokens || rows == batch.size(),
+                        "ContinuousBatchingScheduler got logits of ",
+                        rows,
+                        " rows for ",
+                        batch.size(),
+                        " sequences of ",
+                        tokens,
+                        " tokens");
+
+        std::vector<GeneratedToken> generated;
+        std::unordered_set<const Sequence*> finished;
+        for (size_t i = 0; i < batch.size(); i++) {
+            auto& sequence = *batch[i];
+            sequence.processed += sequence.scheduled;
+            sequence.scheduled = 0;
+            if (sequence.processed < sequence.tokens.size()) {
+                // a prompt chunk
+                continue;
+            }
+            const size_t row = rows == tokens ? static_cast<size_t>(m_subsequence_begins[i + 1] - 1) : i;
+            const float* row_logits = logits.data<const float>() + row * vocab_size;
+            const auto token =
+                m_config.sampler ? m_config.sampler(row_logits, vocab_size) : argmax(row_logits, vocab_size);
+            sequence.tokens.push_back(token);
+            const bool done = token == m_config.eos_token_id ||
+                              sequence.tokens.size() - sequence.prompt_len >= sequence.max_new_tokens;
+            generated.push_back({sequence.id, token, done});
+            if (done) {
+                finished.insert(&sequence);
+            }
+        }
+        if (!finished.empty()) {
+            for (auto it = m_running.begin(); it != m_running.end();) {
+                if (finished.count(&*it)) {
+                    release_blocks(*it);
+                    it = m_running.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+        return generated;
+    }
+
+    const ContinuousBatchingConfig m_config;
+    InferRequest m_request;
+    // number of the tokens of a block
+    size_t m_block_size = 0;
+    std::map<std::string, ov::Output<const ov::Node>> m_inputs{{"input_ids", {}},
+                                                              {"position_ids", {}},
+                                                              {"past_lens", {}},
+                                                              {"subsequence_begins", {}},
+                                                              {"block_indices", {}},
+                                                              {"block_indices_begins", {}},
+                                                              {"max_context_len", {}}};
+    ov::Output<const ov::Node> m_logits;
+    std::vector<int64_t> m_subsequence_begins;
+
+    std::vector<int32_t> m_free_blocks;
+    // in the admission order, the pointers to them stay valid
+    std::list<Sequence> m_running;
+    std::deque<Sequence> m_waiting;
+
+    // guards the requests added and aborted concurrently with the steps
+    mutable std::mutex m_mutex;
+    uint64_t m_next_id = 0;
+    std::vector<Sequence> m_added;
+    std::unordered_set<uint64_t> m_aborted;
+};
+
+void ContinuousBatchingScheduler::set_cache_shapes(const std::shared_ptr<Model>& model,
+                                                   const element::Type& cache_type,
+                                                   size_t block_size) {
+    OPENVINO_ASSERT(model, "ContinuousBatchingScheduler requires a model");
+    OPENVINO_ASSERT(cache_type.is_real() && block_size > 0,
+                    "ContinuousBatchingScheduler requires a floating point cache type and a non-zero block size");
+    bool found = false;
+    for (const auto& node : model->get_ordered_ops()) {
+        const auto paged_attention = ov::as_type_ptr<ov::op::PagedAttentionExtension>(node);
+        if (!paged_attention) {
+            continue;
+        }
+        const auto& rt_info = paged_attention->get_rt_info();
+        for (const auto& [input, heads, head_size] : {std::make_tuple(size_t{3}, "num_k_heads", "k_head_size"),
+                                                      std::make_tuple(size_t{4}, "num_v_heads", "v_head_size")}) {
+            auto cache = ov::as_type_ptr<ov::op::v0::Parameter>(paged_attention->get_input_node_shared_ptr(input));
+            OPENVINO_ASSERT(cache && rt_info.count(heads) && rt_info.count(head_size),
+                            "ContinuousBatchingScheduler requires the cache inputs and the heads of ",
+                            paged_attention->get_friendly_name(),
+                            " set by ov::pass::SDPAToPagedAttention");
+            cache->set_element_type(cache_type);
+            cache->set_partial_shape({-1,
+                                      static_cast<int64_t>(rt_info.at(heads).as<size_t>()),
+                                      static_cast<int64_t>(block_size),
+                                      static_cast<int64_t>(rt_info.at(head_size).as<size_t>())});
+        }
+        found = true;
+    }
+    OPENVINO_ASSERT(found, "ContinuousBatchingScheduler requires a model transformed by SDPAToPagedAttention");
+    model->validate_nodes_and_infer_types();
+}
+
+ContinuousBatchingScheduler::ContinuousBatchingScheduler(CompiledModel& compiled_model,
+                                                         const ContinuousBatchingConfig& config)
+    : _impl{std::make_shared<Impl>(compiled_model, config)} {}
+
+ContinuousBatchingScheduler::~ContinuousBatchingScheduler() = default;
+
+uint64_t ContinuousBatchingScheduler::add_request(std::vector<int64_t> prompt, size_t max_new_tokens) {
+    return _impl->add_request(std::move(prompt), max_new_tokens);
+}
+
+void ContinuousBatchingScheduler::abort_request(uint64_t request_id) {
+    _impl->abort_request(request_id);
+}
+
+std::vector<GeneratedToken> ContinuousBatchingScheduler::step() {
+    return _impl->step();
+}
+
+bool ContinuousBatchingScheduler::has_unfinished_requests() const {
+    return _impl->has_unfinished_requests();
+}
+
+size_t ContinuousBatchingScheduler::free_blocks() const {
+    return _impl->free_blocks();
+}
+
+}  // namespace ov
@@ -120,6 +120,45 @@ CompiledModel Core::compile_model(const std::shared_ptr<const ov::Model>& model,
     });
 }
 
+std::future<CompiledModel> Core::compile_model_async(const std::shared_ptr<const ov::Model>& model,
+                                                     const std::string& device_name,
+                                                     const AnyMap& config) {
+    // unlike std::async, the future of the promise doesn't wait for the compilation on destruction
+    auto promise = std::make_shared<std::promise<CompiledModel>>();
+    auto future = promise->get_future();
+    _impl->run_in_background("CompileModelAsync", [impl = _impl.get(), promise, model, device_name, config]() {
+        OV_ITT_SCOPED_REGION_BASE(ov::itt::domains::Phases, "Compile model async");
+        try {
+            OV_CORE_CALL_STATEMENT({
+                auto exec = impl->compile_model(model, device_name, config);
+                promise->set_value({exec._ptr, exec._so});
+            });
+        } catch (...) {
+            promise->set_exception(std::current_exception());
+        }
+    });
+    return future;
+}
+
+std::future<CompiledModel> Core::compile_model_async(const std::filesystem::path& model_path,
+                                                     const std::string& device_name,
+                                                     const AnyMap& config) {
+    auto promise = std::make_shared<std::promise<CompiledModel>>();
+    auto future = promise->get_future();
+    _impl->run_in_background("CompileModelAsync", [impl = _impl.get(), promise, model_path, device_name, config]() {
+        OV_ITT_SCOPED_REGION_BASE(ov::itt::domains::Phases, "Compile model async");
+        try {
+            OV_CORE_CALL_STATEMENT({
+                auto exec = impl->compile_model(model_path, device_name, config);
+                promise->set_value({exec._ptr, exec._so});
+            });
+        } catch (...) {
+            promise->set_exception(std::current_exception());
+        }
+    });
+    return future;
+}
+
 CompiledModel Core::compile_model(const std::filesystem::path& model_path, const AnyMap& config) {
     OV_ITT_SCOPED_REGION_BASE(ov::itt::domains::Phases, "Compile model");
     return compile_model(model_path, ov::default_device_name, config);
@@ -236,6 +236,23 @@ void InferRequest::start_async() {
     OV_INFER_REQ_CALL_STATEMENT(_impl->start_async());
 }
 
+void InferRequest::set_priority(ov::hint::Priority priority) {
+    OV_INFER_REQ_CALL_STATEMENT(_impl->set_priority(priority));
+}
+
+ov::hint::Priority InferRequest::get_priority() const {
+    OV_INFER_REQ_CALL_STATEMENT(return _impl->get_priority());
+}
+
+void InferRequest::fork_states(const InferRequest& source, size_t position) {
+    OPENVINO_ASSERT(source._impl != nullptr, "Source InferRequest was not initialized.");
+    OV_INFER_REQ_CALL_STATEMENT(_impl->fork_states(source._impl, position));
+}
+
+void InferRequest::trim_states(size_t position) {
+    OV_INFER_REQ_CALL_STATEMENT(_impl->trim_states(position));
+}
+
 void InferRequest::wait() {
     OPENVINO_ASSERT(_impl != nullptr, "InferRequest was not initialized.");
     try {
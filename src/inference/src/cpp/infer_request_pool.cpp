@@ -0,0 +1,141 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/infer_request_pool.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+
+class InferRequestPool::Impl {
+public:
+    Impl(std::vector<InferRequest> requests, const std::vector<ov::Output<const ov::Node>>& outputs)
+        : m_size{requests.size()},
+          m_idle{std::move(requests)},
+          m_outputs{outputs},
+          m_recycled(outputs.size()) {}
+
+    size_t output_index(const ov::Output<const ov::Node>& port) const {
+        const auto found = std::find(m_outputs.begin(), m_outputs.end(), port);
+        OPENVINO_ASSERT(found != m_outputs.end(), "The port is not an output of the compiled model of the pool");
+        return static_cast<size_t>(std::distance(m_outputs.begin(), found));
+    }
+
+    const size_t m_size;
+    std::mutex m_mutex;
+    std::condition_variable m_released;
+    // the requests are reused in the LIFO order, so the most recently used tensors are likely in the cache
+    std::vector<InferRequest> m_idle;
+    const std::vector<ov::Output<const ov::Node>> m_outputs;
+    std::vector<std::vector<Tensor>> m_recycled;
+};
+
+InferRequestPool::InferRequestPool(CompiledModel& compiled_model, size_t size) {
+    if (size == 0) {
+        size = static_cast<size_t>(compiled_model.get_property(ov::optimal_number_of_infer_requests));
+    }
+    OPENVINO_ASSERT(size != 0, "InferRequestPool must have at least one request");
+    std::vector<InferRequest> requests;
+    requests.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+        requests.push_back(compiled_model.create_infer_request());
+        // the plugins may allocate the tensors on the first access, so it is done up front
+        for (const auto& input : compiled_model.inputs()) {
+            requests.back().get_tensor(input);
+        }
+        for (const auto& output : compiled_model.outputs()) {
+            requests.back().get_tensor(output);
+        }
+    }
+    _impl = std::make_shared<Impl>(std::move(requests), compiled_model.outputs());
+}
+
+InferRequestPool::~InferRequestPool() = default;
+
+InferRequest InferRequestPool::acquire() {
+    OPENVINO_ASSERT(_impl != nullptr, "InferRequestPool was not initialized.");
+    std::unique_lock<std::mutex> lock{_impl->m_mutex};
+    _impl->m_released.wait(lock, [this] {
+        return !_impl->m_idle.empty();
+    });
+    auto request = std::move(_impl->m_idle.back());
+    _impl->m_idle.pop_back();
+    return request;
+}
+
+bool InferRequestPool::try_acquire(InferRequest& request) {
+    OPENVINO_ASSERT(_impl != nullptr, "InferRequestPool was not initialized.");
+    std::lock_guard<std::mutex> lock{_impl->m_mutex};
+    if (_impl->m_idle.empty()) {
+        return false;
+    }
+    request = std::move(_impl->m_idle.back());
+    _impl->m_idle.pop_back();
+    return true;
+}
+
+void InferRequestPool::release(InferRequest request) {
+    OPENVINO_ASSERT(_impl != nullptr, "InferRequestPool was not initialized.");
+    OPENVINO_ASSERT(request, "The released InferRequest was not initialized.");
+    {
+        std::lock_guard<std::mutex> lock{_impl->m_mutex};
+        OPENVINO_ASSERT(_impl->m_idle.size() < _impl->m_size, "More requests are released than acquired");
+        _impl->m_idle.push_back(std::move(request));
+    }
+    _impl->m_released.notify_one();
+}
+
+Tensor InferRequestPool::take_output_tensor(InferRequest& request, const ov::Output<const ov::Node>& port) {
+    OPENVINO_ASSERT(_impl != nullptr, "InferRequestPool was not initialized.");
+    const auto index = _impl->output_index(port);
+    auto tensor = request.get_tensor(port);
+    Tensor replacement;
+    {
+        std::lock_guard<std::mutex> lock{_impl->m_mutex};
+        auto& recycled = _impl->m_recycled[index];
+        if (!recycled.empty()) {
+            replacement = std::move(recycled.back());
+            recycled.pop_back();
+        }
+    }
+    if (!replacement) {
+        replacement = Tensor(tensor.get_element_type(), tensor.get_shape());
+    } else if (replacement.get_shape() != tensor.get_shape()) {
+        replacement.set_shape(tensor.get_shape());
+    }
+    request.set_tensor(port, replacement);
+    return tensor;
+}
+
+void InferRequestPool::recycle_output_tensor(const ov::Output<const ov::Node>& port, Tensor tensor) {
+    OPENVINO_ASSERT(_impl != nullptr, "InferRequestPool was not initialized.");
+    OPENVINO_ASSERT(tensor, "The recycled Tensor was not initialized.");
+    const auto index = _impl->output_index(port);
+    std::lock_guard<std::mutex> lock{_impl->m_mutex};
+    // the pool never needs more tensors than the requests have
+    if (_impl->m_recycled[index].size() < _impl->m_size) {
+        _impl->m_recycled[index].push_back(std::move(tensor));
+    }
+}
+
+size_t InferRequestPool::size() const {
+    OPENVINO_ASSERT(_impl != nullptr, "InferRequestPool was not initialized.");
+    return _impl->m_size;
+}
+
+size_t InferRequestPool::available() const {
+    OPENVINO_ASSERT(_impl != nullptr, "InferRequestPool was not initialized.");
+    std::lock_guard<std::mutex> lock{_impl->m_mutex};
+    return _impl->m_idle.size();
+}
+
+}  // namespace ov
@@ -70,13 +70,15 @@ std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& mod
 
 std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& model,
                                      const std::filesystem::path& model_path,
-                                     const ov::AnyMap& compile_options) {
+                                     const ov::AnyMap& compile_options,
+                                     bool structural_rt_info) {
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ReadTime, "ModelCache::compute_hash - Model and path");
 
     OPENVINO_ASSERT(model);
 
     uint64_t seed = 0;
-    // 1. Calculate hash on function, skipping weights if model path is provided
+    // 1. Calculate hash on function, skipping weights if model path is provided.
+    // The weights are hashed concurrently and the hashes of the weights alive since the previous call are reused
     ov::pass::Manager m;
     m.register_pass<ov::pass::Hash>(seed, !model_path.empty());
     m.run_passes(std::const_pointer_cast<ov::Model>(model));
@@ -85,12 +87,16 @@ std::string ModelCache::compute_hash(const std::shared_ptr<const ov::Model>& mod
     seed = hash_combine_options(seed, compile_options);
 
     // 3. Add runtime information which may not be serialized
+    std::stringstream strm;
     for (const auto& op : model->get_ordered_ops()) {
         // Skip runtime attributes which are not hash-able
         for (const auto& [name, attribute] : op->get_rt_info()) {
             if (!attribute.is<ov::RuntimeAttribute>() || attribute.as<ov::RuntimeAttribute>().is_deterministic()) {
                 seed = hash_combine(seed, name);
-                std::stringstream strm;
+                if (structural_rt_info) {
+                    continue;
+                }
+                strm.str({});
                 attribute.print(strm);
                 seed = hash_combine(seed, strm.str());
             }
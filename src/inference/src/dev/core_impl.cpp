@@ -4,6 +4,7 @@
 
 #include "core_impl.hpp"
 
+#include <future>
 #include <memory>
 #include <optional>
 #include <variant>
@@ -214,6 +215,11 @@ static const auto core_properties_names = ov::util::make_array(ov::cache_dir.nam
                                                                ov::cache_path.name(),
                                                                ov::cache_model_path.name(),
                                                                ov::cache_blob_id.name(),
+                                                               ov::internal::cache_structural_hash.name(),
+                                                               ov::internal::cache_max_size.name(),
+                                                               ov::internal::cache_max_entries.name(),
+                                                               ov::internal::cache_async_write.name(),
+                                                               ov::internal::probed_devices.name(),
                                                                ov::enable_mmap.name(),
                                                                ov::force_tbb_terminate.name());
 
@@ -233,6 +239,11 @@ std::filesystem::path extract_weight_path(const std::string& compiled_properties
     }
 }
 
+ov::internal::CacheStatistics get_cache_statistics(const ov::CoreConfig::CacheConfig& cache_config) {
+    const auto file_cache = std::dynamic_pointer_cast<ov::FileStorageCacheManager>(cache_config.m_cache_manager);
+    return file_cache ? file_cache->get_statistics() : ov::internal::CacheStatistics{};
+}
+
 using model_hint_t = std::variant<std::shared_ptr<const ov::Model>, std::filesystem::path>;
 
 ov::SoPtr<ov::ICompiledModel> import_compiled_model(const ov::Plugin& plugin,
@@ -287,6 +298,11 @@ std::vector<ov::Extension::Ptr> try_get_extensions(std::shared_ptr<void>& so) {
     }
 }
 
+bool get_cache_structural_hash(const ov::AnyMap& config) {
+    const auto it = config.find(ov::internal::cache_structural_hash.name());
+    return it != config.end() && it->second.as<bool>();
+}
+
 std::string get_blob_id_or_compute(const ov::AnyMap& user_config, std::function<std::string()>&& calculate_blob_id) {
     if (auto blob_id_hint = user_config.find(ov::cache_blob_id.name()); blob_id_hint != user_config.end()) {
         return blob_id_hint->second.as<std::string>();
@@ -467,6 +483,29 @@ ov::CoreImpl::CoreImpl() {
     }
 }
 
+ov::CoreImpl::~CoreImpl() {
+    std::unique_lock<std::mutex> lock(m_background_tasks_mutex);
+    m_background_tasks_done.wait(lock, [this] {
+        return m_pending_background_tasks == 0;
+    });
+}
+
+void ov::CoreImpl::run_in_background(const std::string& executor_name, ov::threading::Task task) const {
+    {
+        std::lock_guard<std::mutex> lock(m_background_tasks_mutex);
+        ++m_pending_background_tasks;
+    }
+    m_executor_manager->get_executor(executor_name)->run([this, task = std::move(task)]() mutable {
+        task();
+        // the captures are released before the core may be destroyed
+        task = {};
+        std::lock_guard<std::mutex> lock(m_background_tasks_mutex);
+        if (--m_pending_background_tasks == 0) {
+            m_background_tasks_done.notify_all();
+        }
+    });
+}
+
 bool ov::CoreImpl::is_proxy_device(const ov::Plugin& plugin) const {
     return is_proxy_device(plugin.get_name());
 }
@@ -696,6 +735,11 @@ ov::Plugin ov::CoreImpl::get_plugin(const std::string& plugin_name) const {
         // Always use global mutex if iterate over plugins or m_plugin_registry
         std::lock_guard<std::mutex> g_lock(get_mutex());
 
+        // The device mutex is needed only to create the plugin once, the created plugin is returned right away
+        auto it_plugin = m_plugins.find(device_name);
+        if (it_plugin != m_plugins.end())
+            return it_plugin->second;
+
         // Plugin is not created, check that plugin is registered
         it = m_plugin_registry.find(device_name);
         if (it == m_plugin_registry.end()) {
@@ -877,12 +921,17 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     } else if (cache_manager && device_supports_model_caching(plugin, parsed.m_config) && !is_proxy_device(plugin)) {
         emplace_cache_dir_if_supported(parsed.m_config, plugin, cache_dir);
         CacheContent cache_content{cache_manager, parsed.m_core_config.get_enable_mmap(), get_cache_model_path(config)};
+        cache_content.m_limits = parsed.m_core_config.get_cache_limits();
+        cache_content.m_async_write = parsed.m_core_config.get_cache_async_write();
         get_cache_wsh_ctx_manager().init_and_sync_context(std::filesystem::hash_value(cache_dir),
                                                           cache_content.m_shared_ctx);
 
         const auto compiled_config = create_compile_config(plugin, parsed.m_config);
         cache_content.m_blob_id = get_blob_id_or_compute(config, [&] {
-            return ModelCache::compute_hash(model, cache_content.m_model_path, compiled_config);
+            return ModelCache::compute_hash(model,
+                                            cache_content.m_model_path,
+                                            compiled_config,
+                                            get_cache_structural_hash(config));
         });
         cache_content.model = model;
         const auto lock = m_cache_guard.get_hash_lock(cache_content.m_blob_id);
@@ -917,11 +966,16 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     } else if (cache_manager && device_supports_model_caching(plugin, parsed.m_config) && !is_proxy_device(plugin)) {
         emplace_cache_dir_if_supported(parsed.m_config, plugin, cache_dir);
         CacheContent cache_content{cache_manager, parsed.m_core_config.get_enable_mmap(), get_cache_model_path(config)};
+        cache_content.m_limits = parsed.m_core_config.get_cache_limits();
+        cache_content.m_async_write = parsed.m_core_config.get_cache_async_write();
         get_cache_wsh_ctx_manager().init_and_sync_context(std::filesystem::hash_value(cache_dir),
                                                           cache_content.m_shared_ctx);
         const auto compiled_config = create_compile_config(plugin, parsed.m_config);
         cache_content.m_blob_id = get_blob_id_or_compute(config, [&] {
-            return ModelCache::compute_hash(model, cache_content.m_model_path, compiled_config);
+            return ModelCache::compute_hash(model,
+                                            cache_content.m_model_path,
+                                            compiled_config,
+                                            get_cache_structural_hash(config));
         });
         cache_content.model = model;
 
@@ -952,6 +1006,8 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::filesystem:
         CoreConfig::remove_core(parsed.m_config);
         emplace_cache_dir_if_supported(parsed.m_config, plugin, cache_dir);
         CacheContent cache_content{cache_manager, parsed.m_core_config.get_enable_mmap(), model_path};
+        cache_content.m_limits = parsed.m_core_config.get_cache_limits();
+        cache_content.m_async_write = parsed.m_core_config.get_cache_async_write();
         get_cache_wsh_ctx_manager().init_and_sync_context(std::filesystem::hash_value(cache_dir),
                                                           cache_content.m_shared_ctx);
         cache_content.m_blob_id = get_blob_id_or_compute(config, [&] {
@@ -984,6 +1040,8 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
     } else if (cache_manager && device_supports_model_caching(plugin, parsed.m_config) && !is_proxy_device(plugin)) {
         emplace_cache_dir_if_supported(parsed.m_config, plugin, cache_dir);
         CacheContent cache_content{cache_manager, parsed.m_core_config.get_enable_mmap()};
+        cache_content.m_limits = parsed.m_core_config.get_cache_limits();
+        cache_content.m_async_write = parsed.m_core_config.get_cache_async_write();
         get_cache_wsh_ctx_manager().init_and_sync_context(std::filesystem::hash_value(cache_dir),
                                                           cache_content.m_shared_ctx);
         cache_content.m_blob_id = get_blob_id_or_compute(config, [&] {
@@ -1062,16 +1120,22 @@ bool ov::CoreImpl::is_hidden_device(const std::string& device_name) const {
 }
 
 std::vector<std::string> ov::CoreImpl::get_available_devices() const {
-    std::vector<std::string> devices;
-    const std::string propertyName = ov::available_devices.name();
+    const auto probed_devices = m_core_config.get_probed_devices();
+    const auto is_probed = [&probed_devices](const std::string& device_name) {
+        return probed_devices.empty() || util::contains(probed_devices, device_name) ||
+               util::contains(probed_devices, ov::DeviceIDParser(device_name).get_device_name());
+    };
 
+    std::vector<std::string> device_names;
     for (auto&& device_name : get_registered_devices()) {
-        std::vector<std::string> devicesIDs;
         // Skip hidden devices
-        if (is_hidden_device(device_name))
-            continue;
+        if (!is_hidden_device(device_name) && is_probed(device_name))
+            device_names.push_back(std::move(device_name));
+    }
+
+    const auto get_device_ids = [this](const std::string& device_name) {
         try {
-            devicesIDs = get_property(device_name, ov::available_devices.name(), {}).as<std::vector<std::string>>();
+            return get_property(device_name, ov::available_devices.name(), {}).as<std::vector<std::string>>();
         } catch (const ov::Exception&) {
             // plugin is not created by e.g. invalid env
         } catch (const std::runtime_error&) {
@@ -1086,13 +1150,27 @@ std::vector<std::string> ov::CoreImpl::get_available_devices() const {
                            device_name,
                            " device and call GetMetric");
         }
+        return std::vector<std::string>{};
+    };
+
+    // The plugins are created under their own mutexes, so the devices are probed concurrently not to sum up the
+    // loading times of the plugins
+    std::vector<std::future<std::vector<std::string>>> devices_ids;
+    devices_ids.reserve(device_names.size());
+    const auto policy = device_names.size() > 1 ? std::launch::async : std::launch::deferred;
+    for (const auto& device_name : device_names) {
+        devices_ids.push_back(std::async(policy, get_device_ids, std::cref(device_name)));
+    }
 
+    std::vector<std::string> devices;
+    for (size_t i = 0; i < device_names.size(); i++) {
+        const auto devicesIDs = devices_ids[i].get();
         if (devicesIDs.size() > 1) {
             for (auto&& deviceID : devicesIDs) {
-                devices.push_back(device_name + '.' + deviceID);
+                devices.push_back(device_names[i] + '.' + deviceID);
             }
         } else if (!devicesIDs.empty()) {
-            devices.push_back(std::move(device_name));
+            devices.push_back(device_names[i]);
         }
     }
 
@@ -1297,6 +1375,16 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = m_core_config.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
+    } else if (name == ov::internal::cache_max_size.name()) {
+        return decltype(ov::internal::cache_max_size)::value_type(m_core_config.get_cache_limits().m_max_size);
+    } else if (name == ov::internal::cache_max_entries.name()) {
+        return decltype(ov::internal::cache_max_entries)::value_type(m_core_config.get_cache_limits().m_max_entries);
+    } else if (name == ov::internal::cache_async_write.name()) {
+        return decltype(ov::internal::cache_async_write)::value_type(m_core_config.get_cache_async_write());
+    } else if (name == ov::internal::probed_devices.name()) {
+        return decltype(ov::internal::probed_devices)::value_type(m_core_config.get_probed_devices());
+    } else if (name == ov::internal::cache_statistics.name()) {
+        return get_cache_statistics(m_core_config.get_cache_config());
     }
 
     OPENVINO_THROW("Exception is thrown while trying to call get_property with unsupported property: '", name, "'");
@@ -1327,6 +1415,8 @@ ov::Any ov::CoreImpl::get_property(const std::string& device_name,
             m_core_config.get_cache_config_for_device(get_plugin(parsed.m_device_name)).m_cache_dir);
     } else if (name == ov::cache_path.name()) {
         return {m_core_config.get_cache_config_for_device(get_plugin(parsed.m_device_name)).m_cache_dir};
+    } else if (name == ov::internal::cache_statistics.name()) {
+        return get_cache_statistics(m_core_config.get_cache_config_for_device(get_plugin(parsed.m_device_name)));
     }
     return get_plugin(parsed.m_device_name).get_property(name, parsed.m_config);
 }
@@ -1513,51 +1603,93 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model_and_cache(ov::Plugin&
     auto compiled_model = context ? plugin.compile_model(model, context, cfg) : plugin.compile_model(model, cfg);
     if (cache_content.m_cache_manager && device_supports_model_caching(plugin)) {
         try {
-            // need to export network for further import from "cache"
-            OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::LoadTime, "Core::compile_model::Export");
-            std::string compiled_model_runtime_properties;
-            if (device_supports_internal_property(plugin, ov::internal::compiled_model_runtime_properties.name())) {
-                compiled_model_runtime_properties =
-                    plugin.get_property(ov::internal::compiled_model_runtime_properties.name(), {}).as<std::string>();
-            }
-            try {
-                if (cache_content.m_shared_ctx) {
-                    compiled_model->m_weight_context = cache_content.m_shared_ctx->get_context();
-                    auto ctx = compiled_model->get_property(ov::internal::model_sharing_context.name())
-                                   .as<ov::internal::WeightSharingCtxPtr>();
-                    if (ctx) {
-                        cache_content.m_shared_ctx->write_context(*ctx);
-                    }
+            if (cache_content.m_shared_ctx) {
+                compiled_model->m_weight_context = cache_content.m_shared_ctx->get_context();
+                auto ctx = compiled_model->get_property(ov::internal::model_sharing_context.name())
+                               .as<ov::internal::WeightSharingCtxPtr>();
+                if (ctx) {
+                    cache_content.m_shared_ctx->write_context(*ctx);
                 }
-            } catch (const ov::Exception&) {
-                // do nothing if compile model will not return it
             }
-            // write compiled blob
-            cache_content.m_cache_manager->write_cache_entry(cache_content.m_blob_id, [&](std::ostream& stream) {
-                uint32_t header_size_alignment{};
-                if (device_supports_internal_property(plugin, ov::internal::cache_header_alignment.name())) {
-                    header_size_alignment =
-                        plugin.get_property(ov::internal::cache_header_alignment.name(), {}).as<uint32_t>();
-                }
-
-                stream << ov::CompiledBlobHeader(ov::get_openvino_version().buildNumber,
-                                                 ov::ModelCache::calculate_file_info(cache_content.m_model_path),
-                                                 compiled_model_runtime_properties,
-                                                 header_size_alignment);
-                compiled_model->export_model(stream);
-            });
-        } catch (const std::ios_base::failure&) {
-            cache_content.m_cache_manager->remove_cache_entry(cache_content.m_blob_id);
         } catch (const ov::Exception&) {
-            cache_content.m_cache_manager->remove_cache_entry(cache_content.m_blob_id);
-        } catch (...) {
-            cache_content.m_cache_manager->remove_cache_entry(cache_content.m_blob_id);
-            throw;
+            // do nothing if compile model will not return it
+        }
+        if (cache_content.m_async_write) {
+            schedule_cache_write(plugin, compiled_model, cache_content);
+        } else {
+            write_cache_entry(plugin, compiled_model, cache_content);
         }
     }
     return compiled_model;
 }
 
+void ov::CoreImpl::write_cache_entry(const ov::Plugin& plugin,
+                                     const ov::SoPtr<ov::ICompiledModel>& compiled_model,
+                                     const CacheContent& cache_content) const {
+    try {
+        // need to export network for further import from "cache"
+        OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::LoadTime, "Core::compile_model::Export");
+        std::string compiled_model_runtime_properties;
+        if (device_supports_internal_property(plugin, ov::internal::compiled_model_runtime_properties.name())) {
+            compiled_model_runtime_properties =
+                plugin.get_property(ov::internal::compiled_model_runtime_properties.name(), {}).as<std::string>();
+        }
+        // write compiled blob
+        cache_content.m_cache_manager->write_cache_entry(cache_content.m_blob_id, [&](std::ostream& stream) {
+            uint32_t header_size_alignment{};
+            if (device_supports_internal_property(plugin, ov::internal::cache_header_alignment.name())) {
+                header_size_alignment =
+                    plugin.get_property(ov::internal::cache_header_alignment.name(), {}).as<uint32_t>();
+            }
+
+            stream << ov::CompiledBlobHeader(ov::get_openvino_version().buildNumber,
+                                             ov::ModelCache::calculate_file_info(cache_content.m_model_path),
+                                             compiled_model_runtime_properties,
+                                             header_size_alignment);
+            compiled_model->export_model(stream);
+        });
+        evict_cache_entries(cache_content);
+    } catch (const std::ios_base::failure&) {
+        cache_content.m_cache_manager->remove_cache_entry(cache_content.m_blob_id);
+    } catch (const ov::Exception&) {
+        cache_content.m_cache_manager->remove_cache_entry(cache_content.m_blob_id);
+    } catch (...) {
+        cache_content.m_cache_manager->remove_cache_entry(cache_content.m_blob_id);
+        throw;
+    }
+}
+
+void ov::CoreImpl::schedule_cache_write(const ov::Plugin& plugin,
+                                        const ov::SoPtr<ov::ICompiledModel>& compiled_model,
+                                        const CacheContent& cache_content) const {
+    auto content = cache_content;
+    content.model = nullptr;
+    run_in_background("CacheWriter", [this, plugin, model = compiled_model, content]() {
+        try {
+            // the caller holds the lock until the model is returned, so the blob is not read while being written
+            const auto lock = m_cache_guard.get_hash_lock(content.m_blob_id);
+            write_cache_entry(plugin, model, content);
+        } catch (...) {
+            // the entry is removed already, nobody waits for the result
+        }
+    });
+}
+
+void ov::CoreImpl::evict_cache_entries(const CacheContent& cache_content) const {
+    const auto file_cache = std::dynamic_pointer_cast<FileStorageCacheManager>(cache_content.m_cache_manager);
+    if (!file_cache) {
+        return;
+    }
+    const auto& limits = cache_content.m_limits;
+    for (const auto& id :
+         file_cache->get_eviction_candidates(cache_content.m_blob_id, limits.m_max_size, limits.m_max_entries)) {
+        // the entry being read or written by another thread is not evicted, it is in use anyway
+        if (const auto lock = m_cache_guard.try_get_hash_lock(id)) {
+            file_cache->evict_cache_entry(id);
+        }
+    }
+}
+
 ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::load_model_from_cache(
     const CacheContent& cache_content,
     ov::Plugin& plugin,
@@ -1721,8 +1853,11 @@ ov::CoreConfig::CoreConfig(const CoreConfig& other) {
         std::lock_guard<std::mutex> lock(other.m_cache_config_mutex);
         m_cache_config = other.m_cache_config;
         m_devices_cache_config = other.m_devices_cache_config;
+        m_probed_devices = other.m_probed_devices;
     }
     m_flag_enable_mmap = other.m_flag_enable_mmap;
+    m_cache_limits = other.m_cache_limits;
+    m_flag_cache_async_write = other.m_flag_cache_async_write;
 }
 
 void ov::CoreConfig::set(const ov::AnyMap& config, const std::string& device_name) {
@@ -1746,6 +1881,24 @@ void ov::CoreConfig::set(const ov::AnyMap& config, const std::string& device_nam
     if (const auto cfg_entry = config.find(ov::enable_mmap.name()); cfg_entry != config.end()) {
         m_flag_enable_mmap = cfg_entry->second.as<bool>();
     }
+
+    if (const auto cfg_entry = config.find(ov::internal::cache_max_size.name()); cfg_entry != config.end()) {
+        m_cache_limits.m_max_size = cfg_entry->second.as<uint64_t>();
+    }
+
+    if (const auto cfg_entry = config.find(ov::internal::cache_max_entries.name()); cfg_entry != config.end()) {
+        m_cache_limits.m_max_entries = cfg_entry->second.as<uint64_t>();
+    }
+
+    if (const auto cfg_entry = config.find(ov::internal::cache_async_write.name()); cfg_entry != config.end()) {
+        m_flag_cache_async_write = cfg_entry->second.as<bool>();
+    }
+
+    if (const auto cfg_entry = config.find(ov::internal::probed_devices.name()); cfg_entry != config.end()) {
+        auto probed_devices = cfg_entry->second.as<std::vector<std::string>>();
+        std::lock_guard<std::mutex> lock(m_cache_config_mutex);
+        m_probed_devices = std::move(probed_devices);
+    }
 }
 
 void ov::CoreConfig::set_and_update(ov::AnyMap& config, const std::string& device_name) {
@@ -1764,10 +1917,28 @@ std::filesystem::path ov::CoreConfig::get_cache_dir() const {
     return m_cache_config.m_cache_dir;
 }
 
+ov::CoreConfig::CacheConfig ov::CoreConfig::get_cache_config() const {
+    std::lock_guard<std::mutex> lock(m_cache_config_mutex);
+    return m_cache_config;
+}
+
 bool ov::CoreConfig::get_enable_mmap() const {
     return m_flag_enable_mmap;
 }
 
+ov::CoreConfig::CacheLimits ov::CoreConfig::get_cache_limits() const {
+    return m_cache_limits;
+}
+
+bool ov::CoreConfig::get_cache_async_write() const {
+    return m_flag_cache_async_write;
+}
+
+std::vector<std::string> ov::CoreConfig::get_probed_devices() const {
+    std::lock_guard<std::mutex> lock(m_cache_config_mutex);
+    return m_probed_devices;
+}
+
 ov::CoreConfig::CacheConfig ov::CoreConfig::get_cache_config_for_device(const ov::Plugin& plugin) const {
     std::lock_guard<std::mutex> lock(m_cache_config_mutex);
     return m_devices_cache_config.count(plugin.get_name()) ? m_devices_cache_config.at(plugin.get_name())
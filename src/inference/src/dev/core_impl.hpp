@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
+
 #include "cache_guard.hpp"
 #include "cache_manager.hpp"
 #include "dev/plugin.hpp"
@@ -35,6 +38,11 @@ public:
         static CacheConfig create(const std::filesystem::path& dir);
     };
 
+    struct CacheLimits {
+        uint64_t m_max_size{};     // 0 means no limit
+        uint64_t m_max_entries{};  // 0 means no limit
+    };
+
     void set(const ov::AnyMap& config, const std::string& device_name);
 
     /**
@@ -46,8 +54,17 @@ public:
 
     std::filesystem::path get_cache_dir() const;
 
+    // Creating thread-safe copy of global cache config
+    CacheConfig get_cache_config() const;
+
     bool get_enable_mmap() const;
 
+    CacheLimits get_cache_limits() const;
+
+    bool get_cache_async_write() const;
+
+    std::vector<std::string> get_probed_devices() const;
+
     // Creating thread-safe copy of global config including shared_ptr to ICacheManager
     CacheConfig get_cache_config_for_device(const ov::Plugin& plugin) const;
 
@@ -59,6 +76,9 @@ private:
     CacheConfig m_cache_config{};
     std::map<std::string, CacheConfig> m_devices_cache_config{};
     bool m_flag_enable_mmap{true};
+    CacheLimits m_cache_limits{};
+    bool m_flag_cache_async_write{false};
+    std::vector<std::string> m_probed_devices{};
 };
 
 struct Parsed {
@@ -160,6 +180,8 @@ private:
         std::filesystem::path m_model_path{};
         std::shared_ptr<const ov::Model> model{};
         bool m_mmap_enabled{};
+        CoreConfig::CacheLimits m_limits{};
+        bool m_async_write{};
     };
 
     // Core settings (cache config, etc)
@@ -207,6 +229,34 @@ private:
                                                           const ov::SoPtr<ov::IRemoteContext>& context,
                                                           const CacheContent& cache_content) const;
 
+    /**
+     * @brief Exports the compiled model to the cache entry, the entry is removed if the export fails. Shall be called
+     * under the lock of the cache entry.
+     */
+    void write_cache_entry(const ov::Plugin& plugin,
+                           const ov::SoPtr<ov::ICompiledModel>& compiled_model,
+                           const CacheContent& cache_content) const;
+
+    /**
+     * @brief Schedules write_cache_entry() on the background executor, the task takes the lock of the cache entry
+     * itself
+     */
+    void schedule_cache_write(const ov::Plugin& plugin,
+                              const ov::SoPtr<ov::ICompiledModel>& compiled_model,
+                              const CacheContent& cache_content) const;
+
+    // The background tasks (cache writes, asynchronous compilations) refer to the core, so it waits for them on
+    // destruction
+    mutable std::mutex m_background_tasks_mutex;
+    mutable std::condition_variable m_background_tasks_done;
+    mutable size_t m_pending_background_tasks = 0;
+
+    /**
+     * @brief Evicts the least recently used cache entries exceeding the cache limits, the entries locked by other
+     * threads are skipped. Shall be called under the lock of the cache entry just written.
+     */
+    void evict_cache_entries(const CacheContent& cache_content) const;
+
     ov::SoPtr<ov::ICompiledModel> load_model_from_cache(
         const CacheContent& cache_content,
         ov::Plugin& plugin,
@@ -233,7 +283,7 @@ private:
 
 public:
     CoreImpl();
-    ~CoreImpl() override = default;
+    ~CoreImpl() override;
 
     /**
      * @brief Register plugins for devices which are located in .xml configuration file.
@@ -252,6 +302,13 @@ public:
      */
     void register_compile_time_plugins();
 
+    /**
+     * @brief Runs the task on the named executor of the core, the core is destroyed only after the task completes
+     * @param executor_name A name of the executor, the tasks of the same executor run one after another
+     * @param task A task, it shall not throw
+     */
+    void run_in_background(const std::string& executor_name, ov::threading::Task task) const;
+
     // Common API
 
     /**
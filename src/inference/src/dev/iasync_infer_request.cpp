@@ -5,10 +5,13 @@
 #include "openvino/runtime/iasync_infer_request.hpp"
 
 #include <atomic>
+#include <future>
 #include <memory>
 
+#include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/ivariable_state.hpp"
+#include "openvino/runtime/latency_histograms.hpp"
 #include "openvino/runtime/plugin_itt.hpp"
 #include "openvino/runtime/threading/immediate_executor.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
@@ -31,6 +34,20 @@ struct ImmediateStreamsExecutor : public ov::threading::ITaskExecutor {
             _streamsExecutor->execute(std::move(task));
         }
     }
+    void run_with_priority(ov::threading::Task task, ov::hint::Priority priority) override {
+        if (_streamsExecutor->get_streams_num() > 1) {
+            std::packaged_task<void()> packaged_task{std::move(task)};
+            auto future = packaged_task.get_future();
+            _streamsExecutor->run_with_priority(
+                [&packaged_task] {
+                    packaged_task();
+                },
+                priority);
+            future.get();
+        } else {
+            _streamsExecutor->execute(std::move(task));
+        }
+    }
     std::shared_ptr<ov::threading::IStreamsExecutor> _streamsExecutor;
 };
 
@@ -61,6 +78,14 @@ ov::IAsyncInferRequest::IAsyncInferRequest(const std::shared_ptr<IInferRequest>&
                                 m_sync_request->infer();
                             }}};
     }
+    if (auto sync_request = std::dynamic_pointer_cast<ov::ISyncInferRequest>(m_sync_request)) {
+        // not virtual, so the compiled model is taken even if a mock overrides get_compiled_model()
+        const auto& compiled_model = sync_request->ISyncInferRequest::get_compiled_model();
+        if (compiled_model) {
+            m_latency_histograms = compiled_model->get_latency_histograms();
+            m_latency_marks = sync_request.get();
+        }
+    }
 }
 
 void ov::IAsyncInferRequest::wait() {
@@ -110,6 +135,25 @@ void ov::IAsyncInferRequest::set_callback(std::function<void(std::exception_ptr)
     m_callback = std::make_shared<std::function<void(std::exception_ptr)>>(std::move(callback));
 }
 
+void ov::IAsyncInferRequest::set_priority(ov::hint::Priority priority) {
+    check_state();
+    std::lock_guard lock{m_mutex};
+    m_priority = priority;
+}
+
+ov::hint::Priority ov::IAsyncInferRequest::get_priority() const {
+    std::lock_guard lock{m_mutex};
+    return m_priority;
+}
+
+void ov::IAsyncInferRequest::fork_states(const std::shared_ptr<IAsyncInferRequest>&, size_t) {
+    OPENVINO_THROW_NOT_IMPLEMENTED("Forking the states of an infer request is not supported by this plugin");
+}
+
+void ov::IAsyncInferRequest::trim_states(size_t) {
+    OPENVINO_THROW_NOT_IMPLEMENTED("Trimming the states of an infer request is not supported by this plugin");
+}
+
 std::vector<ov::SoPtr<ov::IVariableState>> ov::IAsyncInferRequest::query_state() const {
     check_state();
     return m_sync_request->query_state();
@@ -127,9 +171,11 @@ void ov::IAsyncInferRequest::run_first_stage(const Pipeline::iterator itBeginSta
                                              const Pipeline::iterator itEndStage,
                                              const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor) {
     m_infer_id = g_inference_uid++;
+    m_latency_trace.submitted = std::chrono::steady_clock::now();
     auto& firstStageExecutor = std::get<Stage_e::EXECUTOR>(*itBeginStage);
     OPENVINO_ASSERT(nullptr != firstStageExecutor);
-    firstStageExecutor->run(make_next_stage_task(itBeginStage, itEndStage, std::move(callbackExecutor)));
+    firstStageExecutor->run_with_priority(make_next_stage_task(itBeginStage, itEndStage, std::move(callbackExecutor)),
+                                          m_priority);
 }
 
 ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
@@ -141,6 +187,9 @@ ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
             // Propagate the inference ID through all subsequent stages for this instance of the pipeline
             OV_ITT_SCOPED_REGION_BASE(ov::itt::domains::Inference, "Inference::pipeline", "InferenceID", m_infer_id);
             std::exception_ptr currentException = nullptr;
+            if (m_latency_trace.started < m_latency_trace.submitted) {
+                m_latency_trace.started = std::chrono::steady_clock::now();
+            }
             auto& thisStage = *itStage;
             auto itNextStage = itStage + 1;
             try {
@@ -151,14 +200,23 @@ ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
                     auto& nextStage = *itNextStage;
                     auto& nextStageExecutor = std::get<Stage_e::EXECUTOR>(nextStage);
                     OPENVINO_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(make_next_stage_task(itNextStage, itEndStage, std::move(callbackExecutor)));
+                    nextStageExecutor->run_with_priority(
+                        make_next_stage_task(itNextStage, itEndStage, std::move(callbackExecutor)),
+                        m_priority);
                 }
             } catch (...) {
                 currentException = std::current_exception();
             }
 
             if ((itEndStage == itNextStage) || (nullptr != currentException)) {
-                auto lastStageTask = [this, currentException]() mutable {
+                // the trace is copied as the callback may start the next inference
+                auto latencyTrace = m_latency_trace;
+                latencyTrace.stages_ended = std::chrono::steady_clock::now();
+                if (m_latency_marks) {
+                    latencyTrace.inputs_prepared = m_latency_marks->m_inputs_prepared;
+                    latencyTrace.graph_executed = m_latency_marks->m_graph_executed;
+                }
+                auto lastStageTask = [this, currentException, latencyTrace]() mutable {
                     std::promise<void> promise;
                     std::shared_ptr<std::function<void(std::exception_ptr)>> callback;
                     {
@@ -175,6 +233,7 @@ ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
                         }
                     }
                     if (nullptr == currentException) {
+                        record_latencies(latencyTrace);
                         promise.set_value();
                     } else {
                         promise.set_exception(currentException);
@@ -191,6 +250,20 @@ ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
         std::move(callbackExecutor));
 }
 
+void ov::IAsyncInferRequest::record_latencies(const LatencyTrace& trace) const {
+    if (!m_latency_histograms) {
+        return;
+    }
+    const auto completed = std::chrono::steady_clock::now();
+    // the marks left by the previous inferences are ignored
+    const auto inputs_prepared = trace.inputs_prepared >= trace.started ? trace.inputs_prepared : trace.started;
+    const auto graph_executed = trace.graph_executed >= inputs_prepared ? trace.graph_executed : trace.stages_ended;
+    m_latency_histograms->record(LatencyHistograms::Phase::QUEUE, trace.started - trace.submitted);
+    m_latency_histograms->record(LatencyHistograms::Phase::INPUT, inputs_prepared - trace.started);
+    m_latency_histograms->record(LatencyHistograms::Phase::EXECUTION, graph_executed - inputs_prepared);
+    m_latency_histograms->record(LatencyHistograms::Phase::OUTPUT, completed - graph_executed);
+}
+
 void ov::IAsyncInferRequest::start_async() {
     infer_impl([this] {
         start_async_thread_unsafe();
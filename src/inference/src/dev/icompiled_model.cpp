@@ -171,6 +171,10 @@ void ov::ICompiledModel::release_memory() {
     // nothing to do
 }
 
+std::shared_ptr<ov::LatencyHistograms> ov::ICompiledModel::get_latency_histograms() const {
+    return m_latency_histograms;
+}
+
 ov::ICompiledModel::~ICompiledModel() {
 #if defined(OPENVINO_GNU_LIBC) && !defined(__ANDROID__)
     // Linux memory margent doesn't return system memory immediate after release.
@@ -213,6 +213,14 @@ ov::SoPtr<ov::ITensor>& ov::ISyncInferRequest::get_tensor_ptr(const ov::Output<c
     return it->second;
 }
 
+void ov::ISyncInferRequest::mark_inputs_prepared() {
+    m_inputs_prepared = std::chrono::steady_clock::now();
+}
+
+void ov::ISyncInferRequest::mark_graph_executed() {
+    m_graph_executed = std::chrono::steady_clock::now();
+}
+
 ov::SoPtr<ov::ITensor> ov::ISyncInferRequest::get_tensor(const ov::Output<const ov::Node>& port) const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::Plugin, "get_tensor");
     return get_tensor_ptr(port);
@@ -5,8 +5,12 @@
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
 #include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -25,7 +29,96 @@
 
 namespace ov {
 namespace threading {
+namespace {
+// the executor and the index of the stream thread running on the current thread
+thread_local const void* current_executor = nullptr;
+thread_local size_t current_worker = 0;
+
+void update_max(std::atomic<uint64_t>& max, uint64_t value) {
+    auto current = max.load();
+    while (current < value && !max.compare_exchange_weak(current, value)) {
+    }
+}
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
+    struct QueuedTask {
+        Task task;
+        ov::hint::Priority priority = ov::hint::Priority::DEFAULT;
+        std::chrono::steady_clock::time_point enqueued;
+    };
+
+    // The tasks of a priority are started in the FIFO order, the higher priorities go first. A task waiting longer than
+    // the starvation timeout (if it is set) goes ahead of any task which is not starving
+    class TaskQueue {
+    public:
+        void push(QueuedTask task) {
+            const auto priority = static_cast<size_t>(task.priority);
+            OPENVINO_ASSERT(priority < _queues.size(), "Unsupported task priority");
+            _queues[priority].push_back(std::move(task));
+            ++_size;
+        }
+
+        bool pop(QueuedTask& task, std::chrono::milliseconds starvationTimeout) {
+            std::deque<QueuedTask>* selected = nullptr;
+            for (auto queue = _queues.rbegin(); queue != _queues.rend() && selected == nullptr; ++queue) {
+                if (!queue->empty()) {
+                    selected = &*queue;
+                }
+            }
+            if (selected == nullptr) {
+                return false;
+            }
+            if (starvationTimeout.count() != 0) {
+                const auto deadline = std::chrono::steady_clock::now() - starvationTimeout;
+                for (auto& queue : _queues) {
+                    if (!queue.empty() && queue.front().enqueued <= deadline &&
+                        (selected->front().enqueued > deadline ||
+                         queue.front().enqueued < selected->front().enqueued)) {
+                        selected = &queue;
+                    }
+                }
+            }
+            task = std::move(selected->front());
+            selected->pop_front();
+            --_size;
+            return true;
+        }
+
+        bool empty() const {
+            return _size == 0;
+        }
+
+        size_t size() const {
+            return _size;
+        }
+
+    private:
+        // indexed by ov::hint::Priority
+        std::array<std::deque<QueuedTask>, 3> _queues;
+        size_t _size = 0;
+    };
+
+    // The state of a stream thread. The tasks are queued here in the work-stealing mode only
+    struct Worker {
+        int _numaNodeId = 0;
+        std::mutex _mutex;
+        TaskQueue _taskQueue;
+        std::atomic<uint64_t> _maxQueueDepth{0};
+        std::atomic<uint64_t> _tasks{0};
+        std::atomic<uint64_t> _stolenTasks{0};
+        std::atomic<uint64_t> _totalWaitTime{0};
+        std::atomic<uint64_t> _maxWaitTime{0};
+    };
+
+    // The stream threads of a NUMA node sleep until a task is queued to any of them
+    struct NumaNode {
+        std::mutex _mutex;
+        std::condition_variable _queueCondVar;
+        size_t _pendingTasks = 0;
+        bool _isStopped = false;
+    };
+
     struct Stream {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         struct Observer : public custom::task_scheduler_observer {
@@ -391,6 +484,9 @@ struct CPUStreamsExecutor::Impl {
         } else {
             _usedNumaNodes = std::move(numaNodes);
         }
+        for (auto streamId = 0; streamId < streams_num; ++streamId) {
+            _workers.emplace_back(std::make_unique<Worker>());
+        }
         for (auto streamId = 0; streamId < streams_num; ++streamId) {
             if (_config.get_cpu_reservation()) {
                 std::lock_guard<std::mutex> lock(_cpu_ids_mutex);
@@ -398,34 +494,175 @@ struct CPUStreamsExecutor::Impl {
             }
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config.get_name() + "_" + std::to_string(streamId));
+                current_executor = this;
+                current_worker = static_cast<size_t>(streamId);
+                if (_config.get_work_stealing()) {
+                    StartStealing(*_workers[streamId]);
+                    StealingLoop(*_workers[streamId]);
+                    return;
+                }
                 for (bool stopped = false; !stopped;) {
-                    Task task;
+                    QueuedTask task;
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
                         _queueCondVar.wait(lock, [&] {
                             return !_taskQueue.empty() || (stopped = _isStopped);
                         });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
+                        _taskQueue.pop(task, StarvationTimeout());
                     }
-                    if (task) {
-                        Execute(task, *(_streams->local()));
+                    if (task.task) {
+                        Execute(task, *_workers[streamId], false);
                     }
                 }
             });
         }
+        if (_config.get_work_stealing()) {
+            // the queues are bound to the NUMA nodes of the streams, which are known once the stream threads start
+            std::unique_lock<std::mutex> lock(_mutex);
+            _queueCondVar.wait(lock, [&] {
+                return _startedWorkers == _workers.size();
+            });
+        }
+    }
+
+    void StartStealing(Worker& worker) {
+        const auto numaNodeId = _streams->local()->_numaNodeId;
+        std::unique_lock<std::mutex> lock(_mutex);
+        worker._numaNodeId = numaNodeId;
+        // the stream may be bound to a NUMA node out of the used ones (e.g. the TBB arena of a NUMA node)
+        _numaNodes[numaNodeId];
+        ++_startedWorkers;
+        _queueCondVar.notify_all();
+        // the thread steals from the other threads of the node, so it waits for their NUMA nodes as well
+        _queueCondVar.wait(lock, [&] {
+            return _startedWorkers == _workers.size();
+        });
+    }
+
+    void StealingLoop(Worker& worker) {
+        auto& node = _numaNodes.at(worker._numaNodeId);
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(node._mutex);
+                node._queueCondVar.wait(lock, [&] {
+                    return node._pendingTasks != 0 || node._isStopped;
+                });
+                // the queued tasks are executed before the stop
+                if (node._pendingTasks == 0) {
+                    return;
+                }
+                // the task is reserved, so it is found in the queues of the node below
+                --node._pendingTasks;
+            }
+            QueuedTask task;
+            bool stolen = false;
+            while (!Pop(worker, task)) {
+                for (auto& peer : _workers) {
+                    if (peer.get() != &worker && peer->_numaNodeId == worker._numaNodeId && Pop(*peer, task)) {
+                        stolen = true;
+                        break;
+                    }
+                }
+                if (stolen) {
+                    break;
+                }
+                std::this_thread::yield();
+            }
+            Execute(task, worker, stolen);
+        }
+    }
+
+    // the owner is busy if its queue is not empty, so the thief takes the task the owner would take next
+    bool Pop(Worker& worker, QueuedTask& task) {
+        std::lock_guard<std::mutex> lock(worker._mutex);
+        return worker._taskQueue.pop(task, StarvationTimeout());
+    }
+
+    std::chrono::milliseconds StarvationTimeout() const {
+        return std::chrono::milliseconds{_config.get_starvation_timeout()};
+    }
+
+    void Execute(QueuedTask& task, Worker& worker, bool stolen) {
+        const auto wait = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - task.enqueued)
+                .count());
+        worker._tasks++;
+        if (stolen) {
+            worker._stolenTasks++;
+        }
+        worker._totalWaitTime += wait;
+        update_max(worker._maxWaitTime, wait);
+        Execute(task.task, *(_streams->local()));
     }
 
-    void Enqueue(Task task) {
+    void Enqueue(Task task, ov::hint::Priority priority) {
+        QueuedTask queued{std::move(task), priority, std::chrono::steady_clock::now()};
+        if (_config.get_work_stealing()) {
+            // the task submitted from a stream stays with it, the other ones are distributed round-robin
+            auto& worker = current_executor == this ? *_workers[current_worker]
+                                                    : *_workers[_nextWorker.fetch_add(1) % _workers.size()];
+            {
+                std::lock_guard<std::mutex> lock(worker._mutex);
+                worker._taskQueue.push(std::move(queued));
+                update_max(worker._maxQueueDepth, worker._taskQueue.size());
+            }
+            auto& node = _numaNodes.at(worker._numaNodeId);
+            {
+                std::lock_guard<std::mutex> lock(node._mutex);
+                ++node._pendingTasks;
+            }
+            node._queueCondVar.notify_one();
+            return;
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _taskQueue.push(std::move(queued));
+            update_max(_maxQueueDepth, _taskQueue.size());
         }
         _queueCondVar.notify_one();
     }
 
+    void Stop() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isStopped = true;
+        }
+        _queueCondVar.notify_all();
+        for (auto& node : _numaNodes) {
+            {
+                std::lock_guard<std::mutex> lock(node.second._mutex);
+                node.second._isStopped = true;
+            }
+            node.second._queueCondVar.notify_all();
+        }
+    }
+
+    std::vector<ov::internal::StreamStatistics> GetStatistics() {
+        size_t sharedQueueDepth = 0;
+        if (!_config.get_work_stealing()) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            sharedQueueDepth = _taskQueue.size();
+        }
+        std::vector<ov::internal::StreamStatistics> statistics;
+        for (auto& worker : _workers) {
+            ov::internal::StreamStatistics stream;
+            if (_config.get_work_stealing()) {
+                std::lock_guard<std::mutex> lock(worker->_mutex);
+                stream.queue_depth = worker->_taskQueue.size();
+                stream.max_queue_depth = worker->_maxQueueDepth;
+            } else {
+                stream.queue_depth = sharedQueueDepth;
+                stream.max_queue_depth = _maxQueueDepth;
+            }
+            stream.tasks = worker->_tasks;
+            stream.stolen_tasks = worker->_stolenTasks;
+            stream.total_wait_time_us = worker->_totalWaitTime;
+            stream.max_wait_time_us = worker->_maxWaitTime;
+            statistics.push_back(stream);
+        }
+        return statistics;
+    }
+
     void Execute(const Task& task, Stream& stream) {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_TBB_ADAPTIVE
         auto& arena = stream._taskArena;
@@ -493,8 +730,13 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _threads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    TaskQueue _taskQueue;
+    std::atomic<uint64_t> _maxQueueDepth{0};
     bool _isStopped = false;
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::map<int, NumaNode> _numaNodes;
+    std::atomic<size_t> _nextWorker{0};
+    size_t _startedWorkers = 0;
     std::vector<int> _usedNumaNodes;
     std::shared_ptr<CustomThreadLocal> _streams;
     bool _isExit = false;
@@ -551,11 +793,7 @@ void CPUStreamsExecutor::cpu_reset() {
 CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) : _impl{new Impl{config}} {}
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
-    {
-        std::lock_guard<std::mutex> lock(_impl->_mutex);
-        _impl->_isStopped = true;
-    }
-    _impl->_queueCondVar.notify_all();
+    _impl->Stop();
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
@@ -563,15 +801,23 @@ CPUStreamsExecutor::~CPUStreamsExecutor() {
     }
 }
 
+std::vector<ov::internal::StreamStatistics> CPUStreamsExecutor::get_statistics() const {
+    return _impl->GetStatistics();
+}
+
 void CPUStreamsExecutor::execute(Task task) {
     _impl->Defer(std::move(task));
 }
 
 void CPUStreamsExecutor::run(Task task) {
+    run_with_priority(std::move(task), ov::hint::Priority::DEFAULT);
+}
+
+void CPUStreamsExecutor::run_with_priority(Task task, ov::hint::Priority priority) {
     if (0 == _impl->_config.get_streams()) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), priority);
     }
 }
 
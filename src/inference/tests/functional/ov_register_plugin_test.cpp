@@ -279,6 +279,19 @@ TEST(RegisterPluginTests, unregisterExistingPluginNoThrow) {
     }
 }
 
+TEST(RegisterPluginTests, probedDevicesRestrictAvailableDevices) {
+    ov::Core core;
+    const std::vector<std::string> probed_devices{"UNKNOWN_DEVICE"};
+    OV_ASSERT_NO_THROW(core.set_property(ov::internal::probed_devices(probed_devices)));
+    ASSERT_EQ(core.get_property(ov::internal::probed_devices.name()).as<std::vector<std::string>>(), probed_devices);
+
+    // the registered devices are not probed
+    ASSERT_TRUE(core.get_available_devices().empty());
+
+    OV_ASSERT_NO_THROW(core.set_property(ov::internal::probed_devices(std::vector<std::string>{})));
+    OV_ASSERT_NO_THROW(core.get_available_devices());
+}
+
 TEST(RegisterPluginTests, accessToUnregisteredPluginThrows) {
     ov::Core core;
     std::vector<std::string> devices = core.get_available_devices();
@@ -21,6 +21,12 @@ static constexpr const auto MAX_NUMBER_OF_TASKS_IN_QUEUE = 10;
 
 using Future = std::future<void>;
 
+static IStreamsExecutor::Config workStealingConfig(int streams, int threadsPerStream) {
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, threadsPerStream};
+    config.set_property(ov::internal::streams_work_stealing.name(), true);
+    return config;
+}
+
 class TaskExecutorTests : public ::testing::TestWithParam<std::function<ITaskExecutor::Ptr()>> {};
 
 TEST_P(TaskExecutorTests, canCreateTaskExecutor) {
@@ -236,6 +242,11 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(
             IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, threads / streams});
     },
+    [] {
+        auto streams = get_number_of_cpu_cores();
+        auto threads = parallel_get_max_threads();
+        return std::make_shared<CPUStreamsExecutor>(workStealingConfig(streams, threads / streams));
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     });
@@ -260,6 +271,95 @@ static auto AsyncExecutors = ::testing::Values(
         auto threads = parallel_get_max_threads();
         return std::make_shared<CPUStreamsExecutor>(
             IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams, threads / streams});
+    },
+    [] {
+        auto streams = get_number_of_cpu_cores();
+        auto threads = parallel_get_max_threads();
+        return std::make_shared<CPUStreamsExecutor>(workStealingConfig(streams, threads / streams));
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
+
+TEST(CPUStreamsExecutorTests, workStealingCollectsStatistics) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(workStealingConfig(2, 1));
+    static constexpr int numberOfTasks = 100;
+    std::vector<Future> futures;
+    for (int i = 0; i < numberOfTasks; i++) {
+        futures.emplace_back(async(executor, [] {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }));
+    }
+    for (auto&& future : futures) {
+        OV_ASSERT_NO_THROW(future.get());
+    }
+
+    const auto statistics = executor->get_statistics();
+    ASSERT_EQ(statistics.size(), 2);
+    uint64_t tasks = 0;
+    for (const auto& stream : statistics) {
+        tasks += stream.tasks;
+        EXPECT_EQ(stream.queue_depth, 0);
+        EXPECT_GT(stream.max_queue_depth, 0);
+        EXPECT_LE(stream.stolen_tasks, stream.tasks);
+        EXPECT_LE(stream.max_wait_time_us, stream.total_wait_time_us);
+    }
+    EXPECT_EQ(tasks, numberOfTasks);
+}
+
+static std::vector<int> runPrioritized(IStreamsExecutor::Config config,
+                                       const std::vector<ov::hint::Priority>& priorities,
+                                       std::chrono::milliseconds delay) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(config);
+    // the single stream is busy until all the tasks are queued
+    std::promise<void> started;
+    std::promise<void> release;
+    auto blocker = async(executor, [&] {
+        started.set_value();
+        release.get_future().wait();
+    });
+    started.get_future().wait();
+
+    std::mutex mutex;
+    std::vector<int> order;
+    std::vector<std::shared_ptr<std::promise<void>>> done;
+    for (size_t i = 0; i < priorities.size(); i++) {
+        done.push_back(std::make_shared<std::promise<void>>());
+        executor->run_with_priority(
+            [&, i, promise = done.back()] {
+                {
+                    std::lock_guard<std::mutex> lock{mutex};
+                    order.push_back(static_cast<int>(i));
+                }
+                promise->set_value();
+            },
+            priorities[i]);
+        std::this_thread::sleep_for(delay);
+    }
+    release.set_value();
+    blocker.get();
+    for (auto&& promise : done) {
+        promise->get_future().wait();
+    }
+    return order;
+}
+
+TEST(CPUStreamsExecutorTests, tasksOfHigherPriorityStartFirst) {
+    const std::vector<ov::hint::Priority> priorities{ov::hint::Priority::LOW,
+                                                     ov::hint::Priority::MEDIUM,
+                                                     ov::hint::Priority::HIGH,
+                                                     ov::hint::Priority::MEDIUM};
+    const std::vector<int> expected{2, 1, 3, 0};
+    EXPECT_EQ(runPrioritized({"TestCPUStreamsExecutor", 1, 1}, priorities, std::chrono::milliseconds(0)), expected);
+    EXPECT_EQ(runPrioritized(workStealingConfig(1, 1), priorities, std::chrono::milliseconds(0)), expected);
+}
+
+TEST(CPUStreamsExecutorTests, starvingTaskStartsAheadOfHigherPriority) {
+    const std::vector<ov::hint::Priority> priorities{ov::hint::Priority::LOW, ov::hint::Priority::HIGH};
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 1, 1};
+    EXPECT_EQ(runPrioritized(config, priorities, std::chrono::milliseconds(50)), std::vector<int>({1, 0}));
+
+    config.set_property(ov::internal::streams_starvation_timeout.name(), uint32_t{10});
+    EXPECT_EQ(runPrioritized(config, priorities, std::chrono::milliseconds(50)), std::vector<int>({0, 1}));
+    config.set_property(ov::internal::streams_work_stealing.name(), true);
+    EXPECT_EQ(runPrioritized(config, priorities, std::chrono::milliseconds(50)), std::vector<int>({0, 1}));
+}
@@ -6,12 +6,14 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
 #include <fstream>
 #include <iterator>
 #include <memory>
 #include <stdexcept>
 #include <streambuf>
 #include <string>
+#include <vector>
 
 #include "common_test_utils/common_utils.hpp"
 
@@ -120,5 +122,52 @@ TEST_F(FileStorageCacheManagerTest, DoesNotLeaveAuxiliaryFilesInCacheDirectory)
     EXPECT_EQ(entries.front(), std::filesystem::path{"8.blob"});
 }
 
+TEST_F(FileStorageCacheManagerTest, EvictionCandidatesAreLeastRecentlyUsed) {
+    auto& file_cache = dynamic_cast<FileStorageCacheManager&>(*m_cache_manager);
+    for (const auto* id : {"1", "2", "3"}) {
+        m_cache_manager->write_cache_entry(id, [](std::ostream& stream) {
+            stream << "0123456789";
+        });
+    }
+    const auto now = std::filesystem::file_time_type::clock::now();
+    std::filesystem::last_write_time(blob_path("1"), now - std::chrono::hours(3));
+    std::filesystem::last_write_time(blob_path("2"), now - std::chrono::hours(2));
+    std::filesystem::last_write_time(blob_path("3"), now - std::chrono::hours(1));
+
+    EXPECT_TRUE(file_cache.get_eviction_candidates("3", 0, 0).empty());
+    EXPECT_TRUE(file_cache.get_eviction_candidates("3", 30, 3).empty());
+    EXPECT_EQ(file_cache.get_eviction_candidates("3", 20, 0), std::vector<std::string>({"1"}));
+
+    // the read makes the blob the most recently used one
+    m_cache_manager->read_cache_entry("1", false, [](ICacheManager::CompiledBlobVariant&) {});
+    EXPECT_EQ(file_cache.get_eviction_candidates("3", 20, 0), std::vector<std::string>({"2"}));
+    // the kept blob is skipped even if it is the least recently used one
+    EXPECT_EQ(file_cache.get_eviction_candidates("2", 0, 1), std::vector<std::string>({"3", "1"}));
+}
+
+TEST_F(FileStorageCacheManagerTest, Statistics) {
+    auto& file_cache = dynamic_cast<FileStorageCacheManager&>(*m_cache_manager);
+    m_cache_manager->write_cache_entry("1", [](std::ostream& stream) {
+        stream << "0123456789";
+    });
+
+    size_t reads = 0;
+    const auto reader = [&](ICacheManager::CompiledBlobVariant&) {
+        ++reads;
+    };
+    m_cache_manager->read_cache_entry("1", false, reader);
+    m_cache_manager->read_cache_entry("2", false, reader);
+    file_cache.evict_cache_entry("1");
+    file_cache.evict_cache_entry("2");
+
+    const auto stats = file_cache.get_statistics();
+    EXPECT_EQ(reads, 1);
+    EXPECT_EQ(stats.hits, 1);
+    EXPECT_EQ(stats.misses, 1);
+    EXPECT_EQ(stats.bytes_read, 10);
+    EXPECT_EQ(stats.evictions, 1);
+    EXPECT_FALSE(std::filesystem::exists(blob_path("1")));
+}
+
 }  // namespace
 }  // namespace ov::test
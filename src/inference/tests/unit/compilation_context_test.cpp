@@ -18,6 +18,7 @@
 #include "openvino/op/constant.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
@@ -287,6 +288,76 @@ TEST(NetworkContext, HashWithFutureRt_int64) {
     ASSERT_NE(ov::ModelCache::compute_hash(net2, {}), ov::ModelCache::compute_hash(net3, {}));
 }
 
+TEST(NetworkContext, HashWithStructuralRtInfo) {
+    auto net1 = create_simple_model();
+    auto net2 = create_simple_model();
+    auto net3 = create_simple_model();
+
+    auto& op1 = net1->get_ops().front()->get_rt_info();
+    op1["someFutureKey"] = "hello";
+
+    auto& op2 = net2->get_ops().front()->get_rt_info();
+    op2["someFutureKey"] = "olleh";
+
+    // only the names of the runtime attributes are taken into account
+    ASSERT_EQ(ov::ModelCache::compute_hash(net1, {}, {}, true), ov::ModelCache::compute_hash(net2, {}, {}, true));
+    ASSERT_NE(ov::ModelCache::compute_hash(net2, {}, {}, true), ov::ModelCache::compute_hash(net3, {}, {}, true));
+    ASSERT_NE(ov::ModelCache::compute_hash(net1, {}, {}), ov::ModelCache::compute_hash(net2, {}, {}));
+}
+
+TEST(NetworkContext, HashWithWeights) {
+    auto net1 = create_simple_model();
+    auto net2 = create_simple_model();
+    const auto hash1 = ov::ModelCache::compute_hash(net1, {});
+    // the memoized hashes of the weights alive are reused
+    ASSERT_EQ(hash1, ov::ModelCache::compute_hash(net1, {}));
+    ASSERT_EQ(hash1, ov::ModelCache::compute_hash(net2, {}));
+
+    // the same model, but the weights
+    for (const auto& op : net2->get_ops()) {
+        if (op->get_friendly_name() == "add") {
+            auto add_constant = ov::op::v0::Constant::create(ov::element::i8, ov::Shape{1}, {4});
+            add_constant->set_friendly_name("add_constant");
+            add_constant->get_output_tensor(0).set_names({"add_constant"});
+            op->input(1).replace_source_output(add_constant);
+        }
+    }
+    ASSERT_NE(hash1, ov::ModelCache::compute_hash(net2, {}));
+    ASSERT_EQ(hash1, ov::ModelCache::compute_hash(net1, {}));
+}
+
+TEST(NetworkContext, HashWithWeightViews) {
+    auto create_model = [](const std::shared_ptr<ov::AlignedBuffer>& short_data,
+                           const std::shared_ptr<ov::AlignedBuffer>& long_data) {
+        auto param1 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{2});
+        auto param2 = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{4});
+        auto add1 = std::make_shared<ov::op::v1::Add>(
+            param1,
+            std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{2}, short_data));
+        auto add2 = std::make_shared<ov::op::v1::Add>(
+            param2,
+            std::make_shared<ov::op::v0::Constant>(ov::element::f32, ov::Shape{4}, long_data));
+        return std::make_shared<ov::Model>(ov::OutputVector{add1, add2}, ov::ParameterVector{param1, param2});
+    };
+    auto make_buffer = []() {
+        auto buffer = std::make_shared<ov::AlignedBuffer>(4 * sizeof(float));
+        auto* data = static_cast<float*>(buffer->get_ptr());
+        for (size_t i = 0; i < 4; i++) {
+            data[i] = static_cast<float>(i + 1);
+        }
+        return buffer;
+    };
+    auto buffer = make_buffer();
+    auto view = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(buffer->get_ptr<char>(),
+                                                                                        2 * sizeof(float),
+                                                                                        buffer);
+    auto copy = make_buffer();
+
+    // the views of a buffer starting at the same address are hashed by their own contents, as the separate buffers
+    ASSERT_EQ(ov::ModelCache::compute_hash(create_model(view, buffer), {}),
+              ov::ModelCache::compute_hash(create_model(view, copy), {}));
+}
+
 TEST(NetworkContext, HashWithTensorNames) {
     auto fun1 = create_simple_model();
     auto fun2 = create_simple_model();
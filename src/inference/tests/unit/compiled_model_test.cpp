@@ -7,10 +7,13 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <map>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <stdexcept>
 #include <unit_test_utils/mocks/openvino/runtime/mock_iasync_infer_request.hpp>
+#include <unit_test_utils/mocks/openvino/runtime/mock_isync_infer_request.hpp>
 #include <unit_test_utils/mocks/openvino/runtime/mock_ivariable_state.hpp>
 #include <vector>
 
@@ -18,7 +21,11 @@
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/relu.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
+#include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/ivariable_state.hpp"
+#include "openvino/runtime/latency_histograms.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "openvino/runtime/threading/immediate_executor.hpp"
 #include "openvino/runtime/variable_state.hpp"
 #include "unit_test_utils/mocks/openvino/runtime/mock_icompiled_model.hpp"
 #include "unit_test_utils/mocks/openvino/runtime/mock_iplugin.hpp"
@@ -147,6 +154,112 @@ TEST_F(CompiledModelWithIInferReqTests, QueryState) {
     EXPECT_EQ(MemState_v.size(), 1);
 }
 
+class CompiledModelWithInferRequestPoolTests : public CompiledModelTests {
+protected:
+    void SetUp() override {
+        CompiledModelTests::SetUp();
+        ON_CALL(*mock_compiled_model, inputs()).WillByDefault(ReturnRefOfCopy(model->inputs()));
+        ON_CALL(*mock_compiled_model, outputs()).WillByDefault(ReturnRefOfCopy(model->outputs()));
+        ON_CALL(*mock_compiled_model, create_infer_request()).WillByDefault([] {
+            auto request = std::make_shared<NiceMock<ov::MockIAsyncInferRequest>>();
+            // the request keeps the tensors set to it
+            auto tensors = std::make_shared<std::map<ov::Output<const ov::Node>, ov::SoPtr<ov::ITensor>>>();
+            ON_CALL(*request, get_tensor(_)).WillByDefault([tensors](const ov::Output<const ov::Node>& port) {
+                auto& tensor = (*tensors)[port];
+                if (!tensor) {
+                    tensor = ov::make_tensor(port.get_element_type(), port.get_shape());
+                }
+                return tensor;
+            });
+            ON_CALL(*request, set_tensor(_, _))
+                .WillByDefault([tensors](const ov::Output<const ov::Node>& port, const ov::SoPtr<ov::ITensor>& tensor) {
+                    (*tensors)[port] = tensor;
+                });
+            return request;
+        });
+    }
+};
+
+TEST_F(CompiledModelWithInferRequestPoolTests, AcquireAndRelease) {
+    EXPECT_CALL(*mock_compiled_model, create_infer_request()).Times(2);
+    auto pool = compiled_model.create_infer_request_pool(2);
+    ASSERT_EQ(pool.size(), 2);
+    ASSERT_EQ(pool.available(), 2);
+
+    auto first = pool.acquire();
+    ov::InferRequest second;
+    ASSERT_TRUE(pool.try_acquire(second));
+    ov::InferRequest third;
+    ASSERT_FALSE(pool.try_acquire(third));
+    ASSERT_NE(first, second);
+    ASSERT_EQ(pool.available(), 0);
+
+    pool.release(second);
+    ASSERT_EQ(pool.available(), 1);
+    // the requests are reused, not recreated
+    ASSERT_EQ(pool.acquire(), second);
+    pool.release(first);
+    pool.release(second);
+    ASSERT_THROW(pool.release(second), ov::Exception);
+}
+
+TEST_F(CompiledModelWithInferRequestPoolTests, SizeDefaultsToOptimalNumberOfRequests) {
+    EXPECT_CALL(*mock_compiled_model, get_property(ov::optimal_number_of_infer_requests.name()))
+        .WillOnce(Return(ov::Any(uint32_t{3})));
+    EXPECT_CALL(*mock_compiled_model, create_infer_request()).Times(3);
+    ASSERT_EQ(compiled_model.create_infer_request_pool().size(), 3);
+}
+
+TEST_F(CompiledModelWithInferRequestPoolTests, TakeOutputTensorReusesRecycledTensors) {
+    auto pool = compiled_model.create_infer_request_pool(1);
+    const auto& port = model->output(0);
+    auto request = pool.acquire();
+
+    auto initial = request.get_tensor(port);
+    auto output = pool.take_output_tensor(request, port);
+    ASSERT_EQ(output.data(), initial.data());
+    auto replacement = request.get_tensor(port);
+    ASSERT_NE(replacement.data(), output.data());
+    ASSERT_EQ(replacement.get_shape(), output.get_shape());
+
+    pool.recycle_output_tensor(port, output);
+    ASSERT_EQ(pool.take_output_tensor(request, port).data(), replacement.data());
+    ASSERT_EQ(request.get_tensor(port).data(), output.data());
+    ASSERT_THROW(pool.take_output_tensor(request, model->input(0)), ov::Exception);
+    pool.release(request);
+}
+
+TEST(LatencyHistogramsTests, BucketsArePowersOfTwoMicroseconds) {
+    using namespace std::chrono;
+    ASSERT_EQ(ov::LatencyHistograms::bucket(nanoseconds{999}), 0);
+    ASSERT_EQ(ov::LatencyHistograms::bucket(microseconds{1}), 1);
+    ASSERT_EQ(ov::LatencyHistograms::bucket(microseconds{3}), 2);
+    ASSERT_EQ(ov::LatencyHistograms::bucket(microseconds{4}), 3);
+    ASSERT_EQ(ov::LatencyHistograms::bucket(milliseconds{1}), 10);
+    ASSERT_EQ(ov::LatencyHistograms::bucket(hours{24}), ov::LatencyHistograms::buckets - 1);
+}
+
+TEST_F(CompiledModelTests, LatencyHistogramsCountInferencesOfRequests) {
+    const std::vector<ov::Output<const ov::Node>> no_ports;
+    ON_CALL(*mock_compiled_model, inputs()).WillByDefault(ReturnRef(no_ports));
+    ON_CALL(*mock_compiled_model, outputs()).WillByDefault(ReturnRef(no_ports));
+    auto sync_request = std::make_shared<NiceMock<ov::MockISyncInferRequest>>(mock_compiled_model);
+    auto request = std::make_shared<ov::IAsyncInferRequest>(sync_request,
+                                                            std::make_shared<ov::threading::ImmediateExecutor>(),
+                                                            nullptr);
+    request->infer();
+    request->start_async();
+    request->wait();
+
+    const auto histograms = compiled_model.get_property(ov::internal::latency_histograms);
+    ASSERT_EQ(histograms.size(), ov::LatencyHistograms::phases);
+    for (const auto& phase : {"QUEUE", "INPUT", "EXECUTION", "OUTPUT"}) {
+        const auto& counts = histograms.at(phase);
+        ASSERT_EQ(counts.size(), ov::LatencyHistograms::buckets);
+        ASSERT_EQ(std::accumulate(counts.begin(), counts.end(), uint64_t{0}), 2) << phase;
+    }
+}
+
 class CompiledModelBaseTests : public ::testing::Test {
 protected:
     std::shared_ptr<ov::MockICompiledModel> mock_compiled_model;
@@ -0,0 +1,258 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/continuous_batching_scheduler.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unit_test_utils/mocks/openvino/runtime/mock_iasync_infer_request.hpp>
+#include <vector>
+
+#include "common_test_utils/test_assertions.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_icompiled_model.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_iplugin.hpp"
+
+using namespace ::testing;
+
+namespace {
+
+struct CompiledModel_Impl {
+    typedef std::shared_ptr<ov::ICompiledModel> ov::CompiledModel::*type;
+    friend type get(CompiledModel_Impl);
+};
+
+template <typename Tag, typename Tag::type M>
+struct Rob {
+    friend typename Tag::type get(Tag) {
+        return M;
+    }
+};
+
+template struct Rob<CompiledModel_Impl, &ov::CompiledModel::_impl>;
+
+constexpr size_t vocabSize = 16;
+constexpr size_t blockSize = 4;
+
+// The inputs of a step seen by the model
+struct Step {
+    std::vector<int32_t> pastLens;
+    std::vector<int32_t> subsequenceBegins;
+    std::vector<int32_t> blockIndices;
+    std::vector<int32_t> blockIndicesBegins;
+};
+
+template <typename T>
+std::vector<T> read(const ov::SoPtr<ov::ITensor>& tensor) {
+    const auto* data = static_cast<const T*>(tensor->data());
+    return {data, data + tensor->get_size()};
+}
+
+}  // namespace
+
+class ContinuousBatchingSchedulerTests : public ::testing::Test {
+protected:
+    std::shared_ptr<ov::Model> create_model(ov::element::Type cacheType = ov::element::f32,
+                                            const ov::PartialShape& cacheShape = {-1, 2, blockSize, 8}) {
+        ov::ParameterVector params;
+        auto add = [&](const std::string& name, ov::element::Type type, const ov::PartialShape& shape) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(type, shape));
+            params.back()->set_friendly_name(name);
+            params.back()->output(0).set_names({name});
+            return params.back();
+        };
+        auto input_ids = add("input_ids", ov::element::i64, {-1});
+        add("position_ids", ov::element::i64, {-1});
+        add("past_lens", ov::element::i32, {-1});
+        add("subsequence_begins", ov::element::i32, {-1});
+        add("block_indices", ov::element::i32, {-1});
+        add("block_indices_begins", ov::element::i32, {-1});
+        add("max_context_len", ov::element::i32, {});
+        add("key_cache.0", cacheType, cacheShape);
+        add("value_cache.0", cacheType, cacheShape);
+
+        // the mock computes the logits
+        auto logits = std::make_shared<ov::op::v0::Convert>(input_ids, ov::element::f32);
+        logits->output(0).set_names({"logits"});
+        return std::make_shared<ov::Model>(ov::OutputVector{logits}, params);
+    }
+
+    void SetUp() override {
+        set_model(create_model());
+    }
+
+    void set_model(const std::shared_ptr<ov::Model>& new_model) {
+        model = new_model;
+        plugin = std::make_shared<ov::MockIPlugin>();
+        mock_compiled_model = std::make_shared<NiceMock<ov::MockICompiledModel>>(model, plugin);
+        compiled_model.*get(CompiledModel_Impl()) = mock_compiled_model;
+        ON_CALL(*mock_compiled_model, inputs()).WillByDefault(ReturnRefOfCopy(model->inputs()));
+        ON_CALL(*mock_compiled_model, outputs()).WillByDefault(ReturnRefOfCopy(model->outputs()));
+        ON_CALL(*mock_compiled_model, create_infer_request()).WillByDefault([this] {
+            auto request = std::make_shared<NiceMock<ov::MockIAsyncInferRequest>>();
+            ON_CALL(*request, get_tensor(_)).WillByDefault([this](const ov::Output<const ov::Node>& port) {
+                auto& tensor = tensors[port];
+                if (!tensor) {
+                    const auto shape = port.get_partial_shape().is_static() ? port.get_shape() : ov::Shape{0};
+                    tensor = ov::make_tensor(port.get_element_type(), shape);
+                }
+                return tensor;
+            });
+            ON_CALL(*request, set_tensor(_, _))
+                .WillByDefault([this](const ov::Output<const ov::Node>& port, const ov::SoPtr<ov::ITensor>& tensor) {
+                    tensors[port] = tensor;
+                });
+            // the next token is the input one plus one
+            ON_CALL(*request, infer()).WillByDefault([this] {
+                const auto inputIds = read<int64_t>(tensors.at(model->input("input_ids")));
+                auto logits = ov::make_tensor(ov::element::f32, ov::Shape{inputIds.size(), vocabSize});
+                auto* data = static_cast<float*>(logits->data());
+                std::fill_n(data, logits->get_size(), 0.F);
+                for (size_t i = 0; i < inputIds.size(); i++) {
+                    data[i * vocabSize + (inputIds[i] + 1) % vocabSize] = 1.F;
+                }
+                tensors[model->output(0)] = logits;
+                steps.push_back({read<int32_t>(tensors.at(model->input("past_lens"))),
+                                 read<int32_t>(tensors.at(model->input("subsequence_begins"))),
+                                 read<int32_t>(tensors.at(model->input("block_indices"))),
+                                 read<int32_t>(tensors.at(model->input("block_indices_begins")))});
+            });
+            return request;
+        });
+    }
+
+    void TearDown() override {
+        mock_compiled_model.reset();
+        compiled_model = {};
+        plugin = {};
+    }
+
+    // runs the steps until all the requests are finished
+    std::map<uint64_t, std::vector<int64_t>> generate(ov::ContinuousBatchingScheduler& scheduler) {
+        std::map<uint64_t, std::vector<int64_t>> generated;
+        while (scheduler.has_unfinished_requests()) {
+            for (const auto& token : scheduler.step()) {
+                generated[token.request_id].push_back(token.token);
+            }
+        }
+        return generated;
+    }
+
+    std::shared_ptr<const ov::Model> model;
+    std::shared_ptr<ov::IPlugin> plugin;
+    std::shared_ptr<ov::MockICompiledModel> mock_compiled_model;
+    ov::CompiledModel compiled_model;
+    std::map<ov::Output<const ov::Node>, ov::SoPtr<ov::ITensor>> tensors;
+    std::vector<Step> steps;
+};
+
+TEST_F(ContinuousBatchingSchedulerTests, MixesPrefillChunksAndDecodes) {
+    ov::ContinuousBatchingConfig config;
+    config.num_kv_blocks = 16;
+    config.max_num_batched_tokens = 6;
+    ov::ContinuousBatchingScheduler scheduler(compiled_model, config);
+    ASSERT_EQ(tensors.at(model->input("key_cache.0"))->get_shape(), ov::Shape({16, 2, blockSize, 8}));
+
+    const auto first = scheduler.add_request({1, 2, 3}, 3);
+    const auto second = scheduler.add_request({5, 6, 7, 8, 9, 10, 11}, 2);
+    const auto generated = generate(scheduler);
+    ASSERT_EQ(generated.at(first), std::vector<int64_t>({4, 5, 6}));
+    ASSERT_EQ(generated.at(second), std::vector<int64_t>({12, 13}));
+    ASSERT_EQ(scheduler.free_blocks(), 16);
+
+    // the second prompt is split to fit the budget, then its chunk follows the decode of the first one
+    ASSERT_EQ(steps[0].pastLens, std::vector<int32_t>({0, 0}));
+    ASSERT_EQ(steps[0].subsequenceBegins, std::vector<int32_t>({0, 3, 6}));
+    ASSERT_EQ(steps[1].pastLens, std::vector<int32_t>({3, 3}));
+    ASSERT_EQ(steps[1].subsequenceBegins, std::vector<int32_t>({0, 1, 5}));
+    for (const auto& step : steps) {
+        ASSERT_LE(step.subsequenceBegins.back(), 6);
+        // the sequences don't share the blocks
+        std::set<int32_t> blocks(step.blockIndices.begin(), step.blockIndices.end());
+        ASSERT_EQ(blocks.size(), step.blockIndices.size());
+        for (size_t i = 0; i + 1 < step.subsequenceBegins.size(); i++) {
+            const auto tokens = step.pastLens[i] + step.subsequenceBegins[i + 1] - step.subsequenceBegins[i];
+            const auto blocksNumber = step.blockIndicesBegins[i + 1] - step.blockIndicesBegins[i];
+            ASSERT_EQ(blocksNumber, (tokens + static_cast<int32_t>(blockSize) - 1) / static_cast<int32_t>(blockSize));
+        }
+    }
+}
+
+TEST_F(ContinuousBatchingSchedulerTests, PreemptsWhenOutOfBlocks) {
+    ov::ContinuousBatchingConfig config;
+    config.num_kv_blocks = 3;
+    ov::ContinuousBatchingScheduler scheduler(compiled_model, config);
+
+    // both prompts take a block and a half, so only one of them may grow over its third block
+    const auto first = scheduler.add_request({1, 2, 3, 4, 5, 6}, 4);
+    const auto second = scheduler.add_request({7, 8, 9, 10, 11, 12}, 4);
+    const auto generated = generate(scheduler);
+    ASSERT_EQ(generated.at(first), std::vector<int64_t>({7, 8, 9, 10}));
+    ASSERT_EQ(generated.at(second), std::vector<int64_t>({13, 14, 15, 0}));
+    ASSERT_EQ(scheduler.free_blocks(), 3);
+
+    // the second sequence was recomputed with its generated tokens
+    const auto recomputed = std::find_if(steps.begin() + 1, steps.end(), [](const Step& step) {
+        return std::find(step.pastLens.begin(), step.pastLens.end(), 0) != step.pastLens.end();
+    });
+    ASSERT_NE(recomputed, steps.end());
+}
+
+TEST_F(ContinuousBatchingSchedulerTests, StopsAtEosAndAborts) {
+    ov::ContinuousBatchingConfig config;
+    config.num_kv_blocks = 8;
+    config.eos_token_id = 3;
+    ov::ContinuousBatchingScheduler scheduler(compiled_model, config);
+
+    const auto first = scheduler.add_request({1}, 10);
+    const auto aborted = scheduler.add_request({5}, 10);
+    scheduler.abort_request(aborted);
+    const auto generated = generate(scheduler);
+    ASSERT_EQ(generated.at(first), std::vector<int64_t>({2, 3}));
+    ASSERT_EQ(generated.count(aborted), 0);
+    ASSERT_EQ(scheduler.free_blocks(), 8);
+
+    ASSERT_THROW(scheduler.add_request({1, 2}, 64), ov::Exception);
+    ASSERT_THROW(scheduler.add_request({}, 1), ov::Exception);
+}
+
+TEST_F(ContinuousBatchingSchedulerTests, RequiresStaticCaches) {
+    ov::ContinuousBatchingConfig config;
+    config.num_kv_blocks = 8;
+    // the layout the model gets from SDPAToPagedAttention before the device sets it
+    set_model(create_model(ov::element::dynamic, ov::PartialShape::dynamic(4)));
+    OV_EXPECT_THROW(ov::ContinuousBatchingScheduler scheduler(compiled_model, config),
+                    ov::Exception,
+                    HasSubstr("set_cache_shapes"));
+}
+
+TEST_F(ContinuousBatchingSchedulerTests, PreemptsOnlyNewerSequences) {
+    ov::ContinuousBatchingConfig config;
+    config.num_kv_blocks = 2;
+    config.max_num_batched_tokens = 3;
+    ov::ContinuousBatchingScheduler scheduler(compiled_model, config);
+
+    const auto first = scheduler.add_request({1}, 4);
+    const auto second = scheduler.add_request({6, 6}, 4);
+    const auto generated = generate(scheduler);
+    ASSERT_EQ(generated.at(first), std::vector<int64_t>({2, 3, 4, 5}));
+    ASSERT_EQ(generated.at(second), std::vector<int64_t>({7, 8, 9, 10}));
+    ASSERT_EQ(scheduler.free_blocks(), 2);
+
+    // the second sequence runs out of its block while the first one is scheduled, so it gives its block up itself
+    ASSERT_EQ(steps[3].pastLens, std::vector<int32_t>({3}));
+    ASSERT_EQ(steps[4].pastLens, std::vector<int32_t>({0}));
+    for (size_t i = 1; i < 4; i++) {
+        ASSERT_EQ(steps[i].pastLens[0], static_cast<int32_t>(i));
+    }
+}
@@ -0,0 +1,181 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "openvino/runtime/threading/thread_safe_containers.hpp"
+
+// Throughput of the queues used for the request scheduling by AUTO, AUTO_BATCH and HETERO: N producers push the
+// elements, 4 consumers pop them. The numbers are meaningless in a Debug build.
+
+namespace {
+
+constexpr size_t elements = 1 << 20;
+constexpr size_t consumers = 4;
+constexpr size_t capacity = 1024;
+
+// the implementation of ThreadSafeQueueWithSize preceding the ring buffer
+template <typename T>
+class MutexQueue {
+public:
+    static constexpr const char* name = "Mutex";
+
+    bool try_push(T value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queue.push(std::move(value));
+        return true;
+    }
+    bool try_pop(T& value) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_queue.empty()) {
+            return false;
+        }
+        value = std::move(_queue.front());
+        _queue.pop();
+        return true;
+    }
+
+private:
+    std::queue<T> _queue;
+    std::mutex _mutex;
+};
+
+template <typename T>
+class RingBuffer : public ov::threading::ThreadSafeRingBuffer<T> {
+public:
+    static constexpr const char* name = "RingBuffer";
+
+    RingBuffer() : ov::threading::ThreadSafeRingBuffer<T>(capacity) {}
+};
+
+template <typename T>
+class QueueWithSize : public ov::threading::ThreadSafeQueueWithSize<T> {
+public:
+    static constexpr const char* name = "QueueWithSize";
+
+    QueueWithSize() : ov::threading::ThreadSafeQueueWithSize<T>(capacity) {}
+    bool try_push(T value) {
+        this->push(std::move(value));
+        return true;
+    }
+};
+
+template <typename T>
+class BoundedQueue : public ov::threading::ThreadSafeBoundedQueue<T> {
+public:
+    static constexpr const char* name = "BoundedQueue";
+
+    BoundedQueue() {
+        this->set_capacity(capacity);
+    }
+};
+
+#if ((OV_THREAD == OV_THREAD_TBB) || (OV_THREAD == OV_THREAD_TBB_AUTO) || (OV_THREAD == OV_THREAD_TBB_ADAPTIVE))
+template <typename T>
+class TbbQueue : public tbb::concurrent_queue<T> {
+public:
+    static constexpr const char* name = "TbbQueue";
+
+    bool try_push(T value) {
+        this->push(std::move(value));
+        return true;
+    }
+};
+
+template <typename T>
+class TbbBoundedQueue : public tbb::concurrent_bounded_queue<T> {
+public:
+    static constexpr const char* name = "TbbBoundedQueue";
+
+    TbbBoundedQueue() {
+        this->set_capacity(capacity);
+    }
+};
+#endif
+
+template <typename Queue>
+double measure_mops(size_t producers) {
+    Queue queue;
+    std::atomic<size_t> popped{0};
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads;
+    for (size_t producer = 0; producer < producers; ++producer) {
+        threads.emplace_back([&, producer] {
+            while (!start.load()) {
+                std::this_thread::yield();
+            }
+            for (size_t i = producer; i < elements; i += producers) {
+                while (!queue.try_push(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (size_t consumer = 0; consumer < consumers; ++consumer) {
+        threads.emplace_back([&] {
+            size_t value = 0;
+            while (popped.load(std::memory_order_relaxed) < elements) {
+                if (queue.try_pop(value)) {
+                    popped.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    const auto begin = std::chrono::steady_clock::now();
+    start = true;
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - begin;
+    return static_cast<double>(elements) / elapsed.count();
+}
+
+template <typename Queue>
+class ThreadSafeContainersBenchmark : public ::testing::Test {};
+
+using Queues = ::testing::Types<MutexQueue<size_t>,
+                                RingBuffer<size_t>,
+                                QueueWithSize<size_t>,
+                                BoundedQueue<size_t>
+#if ((OV_THREAD == OV_THREAD_TBB) || (OV_THREAD == OV_THREAD_TBB_AUTO) || (OV_THREAD == OV_THREAD_TBB_ADAPTIVE))
+                                ,
+                                TbbQueue<size_t>,
+                                TbbBoundedQueue<size_t>
+#endif
+                                >;
+
+class QueueNames {
+public:
+    template <typename Queue>
+    static std::string GetName(int) {
+        return Queue::name;
+    }
+};
+
+}  // namespace
+
+TYPED_TEST_SUITE(ThreadSafeContainersBenchmark, Queues, QueueNames);
+
+TYPED_TEST(ThreadSafeContainersBenchmark, throughput) {
+    for (size_t producers = 1; producers <= 64; producers *= 2) {
+        const auto mops = measure_mops<TypeParam>(producers);
+        std::cout << std::setw(3) << producers << " producers, " << consumers << " consumers: " << std::fixed
+                  << std::setprecision(2) << mops << " Mops/s" << std::endl;
+    }
+}
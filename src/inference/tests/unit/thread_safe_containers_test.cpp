@@ -0,0 +1,161 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "openvino/runtime/threading/thread_safe_containers.hpp"
+
+using namespace ::testing;
+using namespace ov::threading;
+
+TEST(ThreadSafeRingBufferTests, isBoundedFifo) {
+    ThreadSafeRingBuffer<int> queue(3);
+    ASSERT_EQ(queue.capacity(), 4);
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_push(i));
+    }
+    ASSERT_FALSE(queue.try_push(4));
+    ASSERT_EQ(queue.size(), 4);
+
+    int value = -1;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(value, i);
+    }
+    ASSERT_FALSE(queue.try_pop(value));
+    ASSERT_EQ(queue.size(), 0);
+}
+
+TEST(ThreadSafeRingBufferTests, releasesPoppedValues) {
+    ThreadSafeRingBuffer<std::shared_ptr<int>> queue(2);
+    auto value = std::make_shared<int>(1);
+    ASSERT_TRUE(queue.try_push(value));
+    std::shared_ptr<int> popped;
+    ASSERT_TRUE(queue.try_pop(popped));
+    popped.reset();
+    ASSERT_EQ(value.use_count(), 1);
+}
+
+namespace {
+struct ThrowingOnCopy {
+    ThrowingOnCopy() = default;
+    ThrowingOnCopy(const ThrowingOnCopy&) {
+        throw std::runtime_error("copy");
+    }
+    ThrowingOnCopy(ThrowingOnCopy&&) = default;
+    ThrowingOnCopy& operator=(const ThrowingOnCopy&) = default;
+    ThrowingOnCopy& operator=(ThrowingOnCopy&&) = default;
+};
+}  // namespace
+
+TEST(ThreadSafeRingBufferTests, skipsValueWhichFailedToConstruct) {
+    ThreadSafeRingBuffer<ThrowingOnCopy> queue(2);
+    const ThrowingOnCopy value;
+    ASSERT_THROW(queue.try_push(value), std::runtime_error);
+    ThrowingOnCopy popped;
+    // the consumer doesn't wait for the cell of the failed push
+    ASSERT_FALSE(queue.try_pop(popped));
+    ASSERT_TRUE(queue.try_push(ThrowingOnCopy{}));
+    ASSERT_TRUE(queue.try_pop(popped));
+    ASSERT_FALSE(queue.try_pop(popped));
+}
+
+TEST(ThreadSafeRingBufferTests, keepsOrderOfEachProducer) {
+    static constexpr int producers = 4;
+    static constexpr int consumers = 4;
+    static constexpr int elements = 10000;
+    ThreadSafeRingBuffer<std::pair<int, int>> queue(64);
+    std::atomic<int> popped{0};
+    std::vector<std::vector<int>> received(consumers * producers);
+
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producers; ++producer) {
+        threads.emplace_back([&, producer] {
+            for (int i = 0; i < elements; ++i) {
+                while (!queue.try_push(std::make_pair(producer, i))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int consumer = 0; consumer < consumers; ++consumer) {
+        threads.emplace_back([&, consumer] {
+            std::pair<int, int> value;
+            while (popped.load() < producers * elements) {
+                if (queue.try_pop(value)) {
+                    received[consumer * producers + value.first].push_back(value.second);
+                    ++popped;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+
+    size_t total = 0;
+    for (auto&& values : received) {
+        total += values.size();
+        for (size_t i = 1; i < values.size(); ++i) {
+            ASSERT_LT(values[i - 1], values[i]);
+        }
+    }
+    ASSERT_EQ(total, producers * elements);
+}
+
+TEST(ThreadSafeQueueWithSizeTests, overflowKeepsOrder) {
+    ThreadSafeQueueWithSize<int> queue(2);
+    for (int i = 0; i < 10; ++i) {
+        queue.push(i);
+    }
+    ASSERT_EQ(queue.size(), 10);
+
+    int value = -1;
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(queue.try_pop(value));
+        ASSERT_EQ(value, i);
+    }
+    ASSERT_FALSE(queue.try_pop(value));
+
+    // the ring buffer is used again once the overflow queue is drained
+    queue.push(10);
+    ASSERT_EQ(queue.size(), 1);
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(value, 10);
+}
+
+TEST(ThreadSafeBoundedQueueTests, isDisabledWithoutCapacity) {
+    ThreadSafeBoundedQueue<int> queue;
+    int value = -1;
+    ASSERT_FALSE(queue.try_push(1));
+
+    queue.set_capacity(2);
+    ASSERT_TRUE(queue.try_push(1));
+    ASSERT_TRUE(queue.try_push(2));
+    ASSERT_FALSE(queue.try_push(3));
+
+    queue.set_capacity(0);
+    ASSERT_FALSE(queue.try_pop(value));
+    ASSERT_FALSE(queue.try_push(3));
+
+    // the queued elements are kept while the queue is disabled
+    queue.set_capacity(2);
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(value, 1);
+}
+
+TEST(ThreadSafeBoundedQueueTests, capacityDoesNotGrow) {
+    ThreadSafeBoundedQueue<int> queue;
+    queue.set_capacity(2);
+    queue.set_capacity(1);
+    ASSERT_THROW(queue.set_capacity(3), ov::Exception);
+}
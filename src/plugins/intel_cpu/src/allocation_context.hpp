@@ -21,6 +21,9 @@ struct AllocationContext {
     std::vector<std::shared_ptr<Edge>> edges;
     GlobalExecutionIndex execIndex;
     std::vector<size_t> syncPoints;
+    // the execution index range of the nodes executed concurrently with the node (inter-op parallelism)
+    // the memory used by the node must be kept for the whole range
+    GlobalExecutionIndex concurrentExecIndex;
 };
 
 }  // namespace ov::intel_cpu
@@ -4,9 +4,12 @@
 
 #include "async_infer_request.h"
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
+#include "infer_request.h"
+#include "openvino/core/except.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
@@ -53,3 +56,32 @@ void ov::intel_cpu::AsyncInferRequest::setSubInferRequest(
 void ov::intel_cpu::AsyncInferRequest::infer() {
     m_infer_func();
 }
+
+void ov::intel_cpu::AsyncInferRequest::fork_states(const std::shared_ptr<ov::IAsyncInferRequest>& source,
+                                                   size_t position) {
+    auto cpu_source = std::dynamic_pointer_cast<AsyncInferRequest>(source);
+    OPENVINO_ASSERT(cpu_source && cpu_source->get_compiled_model() == get_compiled_model(),
+                    "The states can be forked from an infer request of the same compiled model only");
+    check_state();
+    cpu_source->check_state();
+    if (m_has_sub_infers) {
+        // the states are held by the requests of the sub streams
+        for (size_t i = 0; i < m_sub_infer_requests.size(); i++) {
+            m_sub_infer_requests[i]->fork_states(cpu_source->m_sub_infer_requests.at(i), position);
+        }
+        return;
+    }
+    std::static_pointer_cast<SyncInferRequest>(m_internal_request)
+        ->fork_states(*std::static_pointer_cast<SyncInferRequest>(cpu_source->m_internal_request), position);
+}
+
+void ov::intel_cpu::AsyncInferRequest::trim_states(size_t position) {
+    check_state();
+    if (m_has_sub_infers) {
+        for (const auto& request : m_sub_infer_requests) {
+            request->trim_states(position);
+        }
+        return;
+    }
+    std::static_pointer_cast<SyncInferRequest>(m_internal_request)->trim_states(position);
+}
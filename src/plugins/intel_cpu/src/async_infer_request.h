@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <vector>
@@ -26,6 +27,10 @@ public:
 
     void infer() override;
 
+    void fork_states(const std::shared_ptr<ov::IAsyncInferRequest>& source, size_t position) override;
+
+    void trim_states(size_t position) override;
+
     void setSubInferRequest(const std::vector<std::shared_ptr<IAsyncInferRequest>>& requests);
 
     std::vector<std::shared_ptr<ov::IAsyncInferRequest>> getSubInferRequest() const {
@@ -0,0 +1,254 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief This is a thread safe implementation of a preemptive cache with CLOCK (second chance) eviction policy.
+ * The records are distributed over a number of independently locked shards. Each shard keeps the records in a
+ * fixed size slot array, indexed by an open addressing (linear probing) hash table, so neither lookups nor hits
+ * allocate memory or relink list nodes.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define
+ * comparison operator.
+ * @tparam Value is a type that must be copy constructible and copy assignable
+ */
+
+namespace ov::intel_cpu {
+
+template <typename Key, typename Value>
+class ClockCache {
+public:
+    using value_type = std::pair<Key, Value>;
+
+    explicit ClockCache(size_t capacity) : _capacity(capacity) {
+        if (0 == _capacity) {
+            return;
+        }
+        // small caches are not sharded to keep the eviction order exact
+        const size_t numShards = std::clamp<size_t>(_capacity / minShardCapacity, 1, maxShards);
+        _shards.reserve(numShards);
+        for (size_t i = 0; i < numShards; ++i) {
+            const size_t shardCapacity = _capacity / numShards + (i < _capacity % numShards ? 1 : 0);
+            _shards.emplace_back(std::make_unique<Shard>(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+
+    void put(const Key& key, const Value& val) {
+        if (0 == _capacity) {
+            return;
+        }
+        const size_t hash = key.hash();
+        auto& shard = getShard(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        const size_t pos = shard.find(key, bucketHash(hash));
+        if (pos != Shard::npos) {
+            const auto slot = shard.index[pos] - 1;
+            shard.slots[slot]->second = val;
+            shard.referenced[slot] = 1;
+            return;
+        }
+        if (shard.freeSlots.empty()) {
+            shard.evictOne();
+            _evictions.fetch_add(1, std::memory_order_relaxed);
+        }
+        shard.insert(key, val, bucketHash(hash));
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key& key) {
+        if (0 == _capacity) {
+            return Value();
+        }
+        const size_t hash = key.hash();
+        auto& shard = getShard(hash);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        const size_t pos = shard.find(key, bucketHash(hash));
+        if (pos == Shard::npos) {
+            return Value();
+        }
+        const auto slot = shard.index[pos] - 1;
+        shard.referenced[slot] = 1;
+        return shard.slots[slot]->second;
+    }
+
+    /**
+     * @brief Evicts n cache records chosen by the CLOCK policy
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+
+    void evict(size_t n) {
+        size_t shardIdx = 0;
+        size_t emptyInARow = 0;
+        while (n > 0 && emptyInARow < _shards.size()) {
+            auto& shard = *_shards[shardIdx];
+            shardIdx = (shardIdx + 1) % _shards.size();
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (shard.size() == 0) {
+                ++emptyInARow;
+                continue;
+            }
+            emptyInARow = 0;
+            shard.evictOne();
+            _evictions.fetch_add(1, std::memory_order_relaxed);
+            --n;
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the number of records currently stored in the cache
+     */
+    [[nodiscard]] size_t size() const {
+        size_t result = 0;
+        for (const auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            result += shard->size();
+        }
+        return result;
+    }
+
+    /**
+     * @brief Returns the total number of records evicted from the cache
+     */
+    [[nodiscard]] size_t getEvictions() const noexcept {
+        return _evictions.load(std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t minShardCapacity = 64;
+    static constexpr size_t maxShards = 16;
+
+    struct Shard {
+        static constexpr size_t npos = static_cast<size_t>(-1);
+
+        explicit Shard(size_t capacity) : slots(capacity), hashes(capacity), referenced(capacity) {
+            size_t indexSize = 1;
+            while (indexSize < 2 * capacity) {
+                indexSize <<= 1;
+            }
+            index.resize(indexSize, 0);
+            mask = indexSize - 1;
+            freeSlots.reserve(capacity);
+            for (size_t i = capacity; i > 0; --i) {
+                freeSlots.push_back(i - 1);
+            }
+        }
+
+        [[nodiscard]] size_t size() const {
+            return slots.size() - freeSlots.size();
+        }
+
+        // returns the position in the index table or npos
+        [[nodiscard]] size_t find(const Key& key, size_t hash) const {
+            for (size_t pos = hash & mask; index[pos] != 0; pos = (pos + 1) & mask) {
+                const auto slot = index[pos] - 1;
+                if (hashes[slot] == hash && slots[slot]->first == key) {
+                    return pos;
+                }
+            }
+            return npos;
+        }
+
+        void insert(const Key& key, const Value& val, size_t hash) {
+            const auto slot = freeSlots.back();
+            freeSlots.pop_back();
+            slots[slot].emplace(key, val);
+            hashes[slot] = hash;
+            referenced[slot] = 0;
+
+            size_t pos = hash & mask;
+            while (index[pos] != 0) {
+                pos = (pos + 1) & mask;
+            }
+            index[pos] = slot + 1;
+        }
+
+        void evictOne() {
+            // second chance sweep, terminates since the shard is not empty
+            while (true) {
+                const size_t slot = hand;
+                hand = (hand + 1) % slots.size();
+                if (!slots[slot]) {
+                    continue;
+                }
+                if (referenced[slot] != 0) {
+                    referenced[slot] = 0;
+                    continue;
+                }
+                erase(slot);
+                return;
+            }
+        }
+
+        void erase(size_t slot) {
+            size_t hole = hashes[slot] & mask;
+            while (index[hole] != slot + 1) {
+                hole = (hole + 1) & mask;
+            }
+            // backward shift deletion keeps the probe sequences intact without tombstones
+            for (size_t next = (hole + 1) & mask; index[next] != 0; next = (next + 1) & mask) {
+                const size_t ideal = hashes[index[next] - 1] & mask;
+                if (((next - ideal) & mask) >= ((next - hole) & mask)) {
+                    index[hole] = index[next];
+                    hole = next;
+                }
+            }
+            index[hole] = 0;
+            slots[slot].reset();
+            freeSlots.push_back(slot);
+        }
+
+        mutable std::mutex mutex;
+        std::vector<std::optional<value_type>> slots;
+        std::vector<size_t> hashes;
+        std::vector<uint8_t> referenced;
+        std::vector<size_t> freeSlots;
+        // slot index + 1, zero marks an empty bucket
+        std::vector<size_t> index;
+        size_t mask = 0;
+        size_t hand = 0;
+    };
+
+    Shard& getShard(size_t hash) {
+        return *_shards[hash % _shards.size()];
+    }
+
+    size_t bucketHash(size_t hash) const {
+        return hash / _shards.size();
+    }
+
+    size_t _capacity;
+    std::vector<std::unique_ptr<Shard>> _shards;
+    std::atomic_size_t _evictions{0};
+};
+
+}  // namespace ov::intel_cpu
@@ -5,9 +5,24 @@
 #include "multi_cache.h"
 
 #include <atomic>
+#include <mutex>
+#include <shared_mutex>
 
 namespace ov::intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+MultiCache::Statistics MultiCache::getStatistics() const {
+    Statistics result;
+    std::shared_lock<std::shared_mutex> lock(_storageMutex);
+    for (const auto& item : _storage) {
+        const auto stats = item.second->getStatistics();
+        result.hits += stats.hits;
+        result.misses += stats.misses;
+        result.evictions += stats.evictions;
+        result.size += stats.size;
+    }
+    return result;
+}
+
 }  // namespace ov::intel_cpu
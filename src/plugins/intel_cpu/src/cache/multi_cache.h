@@ -7,17 +7,21 @@
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <type_traits>
 #include <unordered_map>
 
 #include "cache_entry.h"
+#include "clock_cache.h"
 
 namespace ov::intel_cpu {
 
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention This implementation IS NOT THREAD SAFE unless it is constructed as a concurrent one. The concurrent cache
+ * stores the records in the sharded ClockCache, so it can be accessed from several threads at once.
  */
 
 class MultiCache {
@@ -26,13 +30,22 @@ public:
     using EntryTypeT = CacheEntry<KeyType, ValueType>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template <typename KeyType, typename ValueType>
+    using ConcurrentEntryTypeT = CacheEntry<KeyType, ValueType, ClockCache<KeyType, ValueType>>;
+    template <typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
+    using Statistics = CacheEntryBase::Statistics;
 
     /**
      * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+     * @param concurrent enables thread safe access to the cache
      * @note zero capacity means empty cache so no records are stored and no entries are created
      */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool concurrent = false) : _capacity(capacity), _concurrent(concurrent) {}
+
+    MultiCache(const MultiCache& other) : _capacity(other._capacity), _concurrent(other._concurrent) {
+        std::shared_lock<std::shared_mutex> lock(other._storageMutex);
+        _storage = other._storage;
+    }
 
     /**
      * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if
@@ -47,18 +60,33 @@ public:
               typename BuilderType,
               typename ValueType = std::invoke_result_t<BuilderType&, const KeyType&>>
     typename CacheEntry<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key, BuilderType builder) {
-        auto entry = getEntry<KeyType, ValueType>();
+        if (_concurrent) {
+            auto entry = getEntry<ConcurrentEntryTypeT<KeyType, ValueType>>();
+            return entry->getOrCreate(key, std::move(builder));
+        }
+        auto entry = getEntry<EntryTypeT<KeyType, ValueType>>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+     * @brief Returns the lookup statistics accumulated over all the entries of the cache
+     */
+    [[nodiscard]] Statistics getStatistics() const;
+
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
 private:
     template <typename T>
     size_t getTypeId();
-    template <typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template <typename EntryType>
+    std::shared_ptr<EntryType> getEntry();
 
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    bool _concurrent;
+    mutable std::shared_mutex _storageMutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -68,10 +96,20 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template <typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template <typename EntryType>
+std::shared_ptr<EntryType> MultiCache::getEntry() {
     size_t id = getTypeId<EntryType>();
+    if (_concurrent) {
+        std::shared_lock<std::shared_mutex> lock(_storageMutex);
+        auto itr = _storage.find(id);
+        if (itr != _storage.end()) {
+            return std::static_pointer_cast<EntryType>(itr->second);
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(_storageMutex, std::defer_lock);
+    if (_concurrent) {
+        lock.lock();
+    }
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
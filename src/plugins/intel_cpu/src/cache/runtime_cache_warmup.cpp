@@ -0,0 +1,157 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "runtime_cache_warmup.h"
+
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/shape.hpp"
+#include "utils/debug_capabilities.h"
+
+namespace ov::intel_cpu {
+
+namespace {
+constexpr const char* fileSignature = "OV_CPU_RUNTIME_CACHE_WARMUP 1";
+}  // namespace
+
+RuntimeCacheWarmup::RuntimeCacheWarmup(std::string path, std::string modelName, size_t numInputs)
+    : m_path(std::move(path)),
+      m_modelName(std::move(modelName)),
+      m_numInputs(numInputs) {
+    load();
+}
+
+void RuntimeCacheWarmup::load() {
+    std::ifstream file(m_path);
+    if (!file.is_open()) {
+        return;
+    }
+
+    std::string line;
+    if (!std::getline(file, line) || line != fileSignature) {
+        DEBUG_LOG("Ignore runtime cache warmup file with unknown format: ", m_path);
+        return;
+    }
+    if (!std::getline(file, line) || line != m_modelName) {
+        DEBUG_LOG("Ignore runtime cache warmup file written for another model: ", m_path);
+        return;
+    }
+    if (!std::getline(file, line) || line != std::to_string(m_numInputs)) {
+        DEBUG_LOG("Ignore runtime cache warmup file with unexpected number of inputs: ", m_path);
+        return;
+    }
+
+    while (std::getline(file, line) && m_loaded.size() < maxRecords) {
+        Record record;
+        if (!fromString(line, record) || record.size() != m_numInputs) {
+            continue;
+        }
+        if (m_known.insert(record).second) {
+            m_loaded.push_back(std::move(record));
+        }
+    }
+    m_full = m_known.size() >= maxRecords;
+}
+
+void RuntimeCacheWarmup::record(const Record& shapes) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_known.size() >= maxRecords || m_known.count(shapes) != 0) {
+        return;
+    }
+    m_known.insert(shapes);
+    m_new.push_back(shapes);
+    if (m_known.size() >= maxRecords) {
+        m_full.store(true, std::memory_order_relaxed);
+    }
+}
+
+void RuntimeCacheWarmup::save() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_new.empty()) {
+        return;
+    }
+
+    // write to a temporary file first, so concurrent readers never observe a partially written file
+    const std::string tmpPath = m_path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::trunc);
+        if (!file.is_open()) {
+            DEBUG_LOG("Cannot write runtime cache warmup file: ", tmpPath);
+            return;
+        }
+        file << fileSignature << '\n' << m_modelName << '\n' << m_numInputs << '\n';
+        for (const auto& record : m_loaded) {
+            file << toString(record) << '\n';
+        }
+        for (const auto& record : m_new) {
+            file << toString(record) << '\n';
+        }
+        if (!file.good()) {
+            return;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, m_path, ec);
+    if (ec) {
+        DEBUG_LOG("Cannot write runtime cache warmup file: ", m_path, " ", ec.message());
+        std::filesystem::remove(tmpPath, ec);
+    }
+}
+
+std::string RuntimeCacheWarmup::toString(const Record& record) {
+    std::stringstream ss;
+    for (size_t i = 0; i < record.size(); ++i) {
+        if (i != 0) {
+            ss << ';';
+        }
+        ss << '[';
+        for (size_t j = 0; j < record[i].size(); ++j) {
+            if (j != 0) {
+                ss << ',';
+            }
+            ss << record[i][j];
+        }
+        ss << ']';
+    }
+    return ss.str();
+}
+
+bool RuntimeCacheWarmup::fromString(const std::string& str, Record& record) {
+    record.clear();
+    std::stringstream ss(str);
+    std::string item;
+    while (std::getline(ss, item, ';')) {
+        if (item.size() < 2 || item.front() != '[' || item.back() != ']') {
+            return false;
+        }
+        ov::Shape shape;
+        std::stringstream dims(item.substr(1, item.size() - 2));
+        std::string dim;
+        while (std::getline(dims, dim, ',')) {
+            try {
+                size_t pos = 0;
+                shape.push_back(std::stoull(dim, &pos));
+                if (pos != dim.size()) {
+                    return false;
+                }
+            } catch (const std::exception&) {
+                return false;
+            }
+        }
+        record.push_back(std::move(shape));
+    }
+    return true;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "openvino/core/shape.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Keeps the list of the input shapes, the dynamic model was executed with, in a file next to the model cache.
+ * The records are loaded when the compiled model is created (or imported from the cache) and are used to run warm up
+ * inferences, so the runtime caches (oneDNN primitives, JIT executors, snippets kernels) for these shapes are populated
+ * before the first user request. The records which were not known at load time are written back to the file when the
+ * compiled model is destroyed.
+ *
+ * @note The generated code itself is not serialized as oneDNN and the snippets generators don't provide a way to
+ * restore a kernel from a binary, so the kernels are regenerated during the warm up instead.
+ */
+class RuntimeCacheWarmup {
+public:
+    using Ptr = std::shared_ptr<RuntimeCacheWarmup>;
+    using Record = std::vector<ov::Shape>;
+
+    /**
+     * @param path is the file the records are loaded from and saved to
+     * @param modelName is the name of the model, the records from a file written for another model are ignored
+     * @param numInputs is the number of the model inputs, i.e. the number of shapes in each record
+     */
+    RuntimeCacheWarmup(std::string path, std::string modelName, size_t numInputs);
+
+    /**
+     * @brief Returns the records loaded from the file
+     */
+    [[nodiscard]] const std::vector<Record>& loadedRecords() const {
+        return m_loaded;
+    }
+
+    /**
+     * @brief Registers the input shapes of an executed inference. Thread safe.
+     */
+    void record(const Record& shapes);
+
+    /**
+     * @brief Returns true when no more records are accepted, so the callers may skip collecting the shapes
+     */
+    [[nodiscard]] bool isFull() const {
+        return m_full.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Writes all the known records to the file if there are new ones since the load
+     */
+    void save() const;
+
+    static std::string toString(const Record& record);
+    static bool fromString(const std::string& str, Record& record);
+
+    static constexpr size_t maxRecords = 256;
+
+private:
+    void load();
+
+    std::string m_path;
+    std::string m_modelName;
+    size_t m_numInputs;
+
+    std::vector<Record> m_loaded;
+    mutable std::mutex m_mutex;
+    std::set<Record> m_known;
+    std::vector<Record> m_new;
+    std::atomic<bool> m_full{false};
+};
+
+}  // namespace ov::intel_cpu
@@ -5,38 +5,52 @@
 #include "compiled_model.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <exception>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <random>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "async_infer_request.h"
+#include "cache/multi_cache.h"
 #include "config.h"
+#include "cpu_memory.h"
 #include "cpu_parallel.hpp"
 #include "graph.h"
 #include "graph_context.h"
 #include "infer_request.h"
 #include "internal_properties.hpp"
+#include "itt.h"
 #include "low_precision/low_precision.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/system_conf.hpp"
+#include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/threading/cpu_message.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
 #include "sub_memory_manager.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
+#include "utils/graph_serializer/repacked_weights.hpp"
 #include "utils/graph_serializer/serializer.hpp"
 #ifdef CPU_DEBUG_CAPS
 #    include "utils/memory_stats_dump.hpp"
@@ -71,19 +85,31 @@ CompiledModel::~CompiledModel() {
         streamsExecutor->cpu_reset();
     }
     CPU_DEBUG_CAP_ENABLE(dumpMemoryStats(m_cfg.debugCaps, m_name, m_graphs, m_socketWeights));
+    if (m_rtCacheWarmup) {
+        try {
+            m_rtCacheWarmup->save();
+        } catch (...) {
+            // the warmup records are an optimization hint, so failing to store them must not break the destruction
+        }
+    }
 }
 
 CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              Config cfg,
                              const bool loaded_from_cache,
-                             std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                             std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                             std::shared_ptr<ov::AlignedBuffer> repacked_weights,
+                             std::shared_ptr<const ConstantOffsets> constant_offsets)
     : ov::ICompiledModel::ICompiledModel(model, plugin),
       m_model(model),
       m_plugin(plugin),
       m_cfg{std::move(cfg)},
       m_name{model->get_name()},
       m_loaded_from_cache(loaded_from_cache),
+      m_repackedWeightsSection(std::move(repacked_weights)),
+      m_constantOffsets(std::move(constant_offsets)),
+      m_socketWeights(m_cfg.processWideWeightsCache),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
     const auto& core = m_plugin->get_core();
@@ -119,6 +145,23 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
 
     m_optimized_single_stream = all_of(1, executor_config.get_streams(), executor_config.get_threads());
 
+    if (m_repackedWeightsSection) {
+        // the nodes find the repacked weights in the caches instead of repacking the original ones
+        uint64_t sectionId = 0;
+        m_repackedWeights =
+            RepackedWeightsSection::read(m_repackedWeightsSection, GraphContext::getEngine(), sectionId);
+        for (int socketId = 0; socketId < get_num_sockets(); socketId++) {
+            if (m_constantOffsets) {
+                m_socketWeights[socketId]->setWeightsOffsets(sectionId, m_constantOffsets);
+            }
+            for (const auto& record : m_repackedWeights) {
+                m_socketWeights[socketId]->findOrCreateShared(record.first, [&record]() {
+                    return record.second;
+                });
+            }
+        }
+    }
+
     int streams = std::max(1, executor_config.get_streams());
     std::vector<Task> tasks;
     tasks.resize(streams);
@@ -153,6 +196,8 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
         sub_cfg.numSubStreams = 0;
         sub_cfg.enableNodeSplit = true;
         auto streams_info_table = m_cfg.streamExecutorConfig.get_streams_info_table();
+        const auto workStealing = m_cfg.streamExecutorConfig.get_work_stealing();
+        const auto starvationTimeout = m_cfg.streamExecutorConfig.get_starvation_timeout();
         auto message = message_manager();
         m_sub_memory_manager = std::make_shared<SubMemoryManager>(m_cfg.numSubStreams);
         message->set_num_sub_streams(m_cfg.numSubStreams);
@@ -169,27 +214,45 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                                                                     true,
                                                                     std::move(sub_streams_table),
                                                                     sub_cfg.streamsRankTable[i]};
-            m_sub_compiled_models.push_back(
-                std::make_shared<CompiledModel>(model, plugin, sub_cfg, loaded_from_cache, m_sub_memory_manager));
+            sub_cfg.streamExecutorConfig.set_property(
+                {{ov::internal::streams_work_stealing.name(), workStealing},
+                 {ov::internal::streams_starvation_timeout.name(), starvationTimeout}});
+            m_sub_compiled_models.push_back(std::make_shared<CompiledModel>(model,
+                                                                            plugin,
+                                                                            sub_cfg,
+                                                                            loaded_from_cache,
+                                                                            m_sub_memory_manager,
+                                                                            m_repackedWeightsSection,
+                                                                            m_constantOffsets));
+        }
+    }
+
+    if (!m_cfg.rtCacheWarmupFile.empty() && !m_has_sub_compiled_models && m_graphs.front().IsDynamic()) {
+        m_rtCacheWarmup =
+            std::make_shared<RuntimeCacheWarmup>(m_cfg.rtCacheWarmupFile, m_name, m_model->inputs().size());
+    }
+}
+
+size_t CompiledModel::get_graph_idx() const {
+    if (m_graphs.size() > 1) {
+        auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
+        if (nullptr != streamsExecutor) {
+            return streamsExecutor->get_stream_id() % m_graphs.size();
         }
     }
+    return 0;
 }
 
 CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
-    int streamId = 0;
     int socketId = 0;
-
-    size_t graph_idx = 0;
     if (m_graphs.size() > 1) {
         auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
         if (nullptr != streamsExecutor) {
-            streamId = streamsExecutor->get_stream_id();
             socketId = std::max(0, streamsExecutor->get_socket_id());
         }
-        graph_idx = streamId % m_graphs.size();
     }
 
-    auto graphLock = GraphGuard::Lock(m_graphs[graph_idx]);
+    auto graphLock = GraphGuard::Lock(m_graphs[get_graph_idx()]);
 
     if (!graphLock._graph.IsReady()) {
         std::exception_ptr exception;
@@ -253,6 +316,70 @@ std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() co
     return async_infer_request;
 }
 
+void CompiledModel::warm_up_runtime_cache() {
+    if (!m_rtCacheWarmup || m_rtCacheWarmup->loadedRecords().empty()) {
+        return;
+    }
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "CompiledModel::warm_up_runtime_cache");
+
+    const auto& inputs = this->inputs();
+    auto warmUpGraph = [&] {
+        // a dedicated request is used, so the user visible states are not affected
+        auto request = std::static_pointer_cast<AsyncInferRequest>(create_infer_request());
+        for (const auto& record : m_rtCacheWarmup->loadedRecords()) {
+            try {
+                for (size_t i = 0; i < inputs.size(); ++i) {
+                    const auto& type = inputs[i].get_element_type();
+                    ov::Tensor tensor(type, record[i]);
+                    if (type != ov::element::string) {
+                        std::memset(tensor.data(), 0, tensor.get_byte_size());
+                    }
+                    request->set_tensor(inputs[i], ov::get_tensor_impl(tensor));
+                }
+                request->m_internal_request->infer();
+            } catch (const std::exception& e) {
+                DEBUG_LOG("Runtime cache warmup failed for shapes ",
+                          RuntimeCacheWarmup::toString(record),
+                          ": ",
+                          e.what());
+            }
+        }
+    };
+
+    auto streamsExecutor = std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor);
+    if (m_graphs.size() == 1 || nullptr == streamsExecutor) {
+        warmUpGraph();
+        return;
+    }
+
+    // the same way as for the graphs creation, the tasks are not guaranteed to be spread over all the streams
+    std::mutex warmedMutex;
+    std::vector<bool> warmed(m_graphs.size(), false);
+    auto allWarmed = [&] {
+        std::lock_guard<std::mutex> lock(warmedMutex);
+        return std::all_of(warmed.begin(), warmed.end(), [](bool value) {
+            return value;
+        });
+    };
+    std::vector<Task> tasks(m_graphs.size());
+    do {
+        for (auto&& task : tasks) {
+            task = [&] {
+                const auto graph_idx = get_graph_idx();
+                {
+                    std::lock_guard<std::mutex> lock(warmedMutex);
+                    if (warmed[graph_idx]) {
+                        return;
+                    }
+                    warmed[graph_idx] = true;
+                }
+                warmUpGraph();
+            };
+        }
+        m_task_executor->run_and_wait(tasks);
+    } while (!allWarmed());
+}
+
 std::shared_ptr<const ov::Model> CompiledModel::get_runtime_model() const {
     OPENVINO_ASSERT(!m_graphs.empty(), "No graph was found");
 
@@ -266,6 +393,32 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         return m_loaded_from_cache;
     }
 
+    if (name == ov::intel_cpu::cpu_runtime_cache_statistics) {
+        MultiCache::Statistics total;
+        // each graph is locked the same way as by get_graph(), the graphs of the other streams may be in use
+        for (auto& graph : m_graphs) {
+            const auto graphLock = GraphGuard::Lock(graph);
+            if (!graphLock._graph.IsReady()) {
+                continue;
+            }
+            const auto stats = graphLock._graph.getGraphContext()->getParamsCache()->getStatistics();
+            total.hits += stats.hits;
+            total.misses += stats.misses;
+            total.evictions += stats.evictions;
+            total.size += stats.size;
+        }
+        return decltype(ov::intel_cpu::cpu_runtime_cache_statistics)::value_type{{"HITS", total.hits},
+                                                                                  {"MISSES", total.misses},
+                                                                                  {"EVICTIONS", total.evictions},
+                                                                                  {"SIZE", total.size}};
+    }
+
+    if (name == ov::internal::streams_statistics) {
+        const auto executor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_task_executor);
+        return decltype(ov::internal::streams_statistics)::value_type{
+            executor ? executor->get_statistics() : std::vector<ov::internal::StreamStatistics>{}};
+    }
+
     Config engConfig = get_graph()._graph.getConfig();
     auto option = engConfig._config.find(name);
     if (option != engConfig._config.end()) {
@@ -309,7 +462,8 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
             RO_property(ov::key_cache_precision.name()),
             RO_property(ov::value_cache_precision.name()),
             RO_property(ov::key_cache_group_size.name()),
-            RO_property(ov::value_cache_group_size.name())};
+            RO_property(ov::value_cache_group_size.name()),
+            RO_property(ov::intel_cpu::cpu_runtime_cache_statistics.name())};
 
         return ro_properties;
     }
@@ -415,8 +569,26 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
 }
 
 void CompiledModel::export_model(std::ostream& modelStream) const {
-    ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt, m_cfg.m_cache_mode == ov::CacheMode::OPTIMIZE_SIZE);
+    const bool optimizeSize = m_cfg.m_cache_mode == ov::CacheMode::OPTIMIZE_SIZE;
+    ModelSerializer serializer(modelStream, m_cfg.cacheEncrypt, optimizeSize);
     serializer << m_model;
+
+    // the repacked weights are as big as the original ones, so they are not stored in the blob optimized for size
+    if (m_cfg.cacheRepackedWeights && !optimizeSize) {
+        // the id qualifies the offsets the records are keyed by, so the blobs of the models with the same layout but
+        // different weights don't collide in the process wide cache, while the imports of the same blob do share
+        std::random_device device;
+        const auto sectionId = (static_cast<uint64_t>(device()) << 32U) | device();
+
+        std::map<std::string, MemoryPtr> weights;
+        for (int socketId = 0; socketId < get_num_sockets(); socketId++) {
+            for (auto& [key, memory] :
+                 m_socketWeights[socketId]->sharedObjects(sectionId, serializer.constant_offsets())) {
+                weights.emplace(key, std::move(memory));
+            }
+        }
+        RepackedWeightsSection::write(modelStream, sectionId, {weights.begin(), weights.end()});
+    }
 }
 
 void CompiledModel::release_memory() {
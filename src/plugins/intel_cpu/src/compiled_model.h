@@ -13,17 +13,20 @@
 #include <utility>
 #include <vector>
 
+#include "cache/runtime_cache_warmup.h"
 #include "config.h"
 #include "graph.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/icompiled_model.hpp"
 #include "openvino/runtime/iinfer_request.hpp"
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
 #include "sub_memory_manager.hpp"
+#include "utils/graph_serializer/repacked_weights.hpp"
 #include "weights_cache.hpp"
 
 namespace ov::intel_cpu {
@@ -44,7 +47,9 @@ public:
                   const std::shared_ptr<const ov::IPlugin>& plugin,
                   Config cfg,
                   bool loaded_from_cache,
-                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                  std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                  std::shared_ptr<ov::AlignedBuffer> repacked_weights = nullptr,
+                  std::shared_ptr<const ConstantOffsets> constant_offsets = nullptr);
 
     ~CompiledModel() override;
 
@@ -63,6 +68,12 @@ public:
 
     void release_memory() override;
 
+    /**
+     * @brief Runs inferences with the input shapes recorded in the runtime cache warmup file (if any) on each stream,
+     * so the runtime caches of all the stream graphs are populated before the first user request.
+     */
+    void warm_up_runtime_cache();
+
     std::string name() const {
         return m_name;
     }
@@ -84,6 +95,11 @@ private:
     std::string m_name;
 
     const bool m_loaded_from_cache;
+    // the repacked weights imported from the blob, the graphs may alias the section
+    std::shared_ptr<ov::AlignedBuffer> m_repackedWeightsSection;
+    // the offsets of the imported constants data identifying the weights the records were repacked from
+    std::shared_ptr<const ConstantOffsets> m_constantOffsets;
+    RepackedWeightsSection::Records m_repackedWeights;
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
@@ -93,6 +109,7 @@ private:
      *       even from main thread
      */
     GraphGuard::Lock get_graph() const;
+    size_t get_graph_idx() const;
 
     std::vector<std::shared_ptr<CompiledModel>> get_sub_compiled_models() const {
         return m_sub_compiled_models;
@@ -102,6 +119,7 @@ private:
     std::shared_ptr<SubMemoryManager> m_sub_memory_manager = nullptr;
     bool m_has_sub_compiled_models = false;
     bool m_optimized_single_stream = false;
+    RuntimeCacheWarmup::Ptr m_rtCacheWarmup = nullptr;
 };
 
 // This class provides safe access to the internal CompiledModel structures and helps to decouple SyncInferRequest and
@@ -152,6 +170,10 @@ public:
         return m_id;
     }
 
+    [[nodiscard]] const RuntimeCacheWarmup::Ptr& runtimeCacheWarmup() const {
+        return m_compiled_model->m_rtCacheWarmup;
+    }
+
 private:
     std::shared_ptr<const CompiledModel> m_compiled_model;
     const Graph* m_graph;
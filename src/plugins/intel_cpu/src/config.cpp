@@ -285,6 +285,108 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
             snippetsCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::cpu_runtime_cache_warmup_file.name() == key) {
+            try {
+                rtCacheWarmupFile = val.as<std::string>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::cpu_runtime_cache_warmup_file.name());
+            }
+        } else if (key == ov::intel_cpu::cpu_dynamic_memory_growth_factor.name()) {
+            float val_f = 0.0F;
+            try {
+                val_f = val.as<float>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::intel_cpu::cpu_dynamic_memory_growth_factor.name(),
+                               ". Expected only float numbers");
+            }
+            OPENVINO_ASSERT(val_f >= 1.F && val_f <= 4.F,
+                            "Wrong value for property key ",
+                            ov::intel_cpu::cpu_dynamic_memory_growth_factor.name(),
+                            ". Growth factor must be in range [1.0f,4.0f]");
+            dynamicMemoryGrowthFactor = val_f;
+        } else if (key == ov::intel_cpu::cpu_dynamic_memory_arena_limit.name()) {
+            try {
+                dynamicMemoryArenaLimit = static_cast<size_t>(val.as<uint64_t>());
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_dynamic_memory_arena_limit.name(),
+                               ". Expected only non-negative integer numbers");
+            }
+        } else if (ov::intel_cpu::cpu_process_wide_weights_cache.name() == key) {
+            try {
+                processWideWeightsCache = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_process_wide_weights_cache.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_inter_op_parallelism.name() == key) {
+            uint32_t val_i = 0;
+            try {
+                val_i = val.as<uint32_t>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_inter_op_parallelism.name(),
+                               ". Expected only positive integer numbers");
+            }
+            OPENVINO_ASSERT(val_i >= 1,
+                            "Wrong value for property key ",
+                            ov::intel_cpu::cpu_inter_op_parallelism.name(),
+                            ". Expected only positive integer numbers");
+            interOpParallelism = val_i;
+        } else if (ov::intel_cpu::cpu_kv_cache_native_state.name() == key) {
+            try {
+                kvCacheNativeState = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_kv_cache_native_state.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_cache_repacked_weights.name() == key) {
+            try {
+                cacheRepackedWeights = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_cache_repacked_weights.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_kv_cache_spill_dir.name() == key) {
+            try {
+                kvCacheSpillDir = val.as<std::string>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::cpu_kv_cache_spill_dir.name());
+            }
+        } else if (ov::intel_cpu::cpu_kv_cache_dram_blocks.name() == key) {
+            try {
+                kvCacheDramBlocks = static_cast<size_t>(val.as<uint64_t>());
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_kv_cache_dram_blocks.name(),
+                               ". Expected only non-negative integer numbers");
+            }
+        } else if (ov::intel_cpu::cpu_moe_grouped_gemm_min_tokens.name() == key) {
+            try {
+                moeGroupedGemmMinTokens = static_cast<size_t>(val.as<uint64_t>());
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_moe_grouped_gemm_min_tokens.name(),
+                               ". Expected only non-negative integer numbers");
+            }
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
@@ -75,6 +75,16 @@ struct Config {
     size_t rtCacheCapacity = 5000UL;
 #endif
     size_t snippetsCacheCapacity = 5000UL;
+    std::string rtCacheWarmupFile;
+    float dynamicMemoryGrowthFactor = 1.0F;
+    size_t dynamicMemoryArenaLimit = 0UL;
+    bool processWideWeightsCache = false;
+    size_t interOpParallelism = 1UL;
+    bool kvCacheNativeState = false;
+    bool cacheRepackedWeights = false;
+    std::string kvCacheSpillDir;
+    size_t kvCacheDramBlocks = 0UL;
+    size_t moeGroupedGemmMinTokens = 4UL;
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
     ov::element::Type kvCachePrecision = ov::element::u8;
     ov::element::Type keyCachePrecision = ov::element::u8;
@@ -20,6 +20,7 @@
 #include "openvino/core/except.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/system_conf.hpp"
 
@@ -1436,6 +1437,8 @@ std::vector<std::vector<int>> generate_stream_info(const int streams,
                                                 config.enableCpuReservation,
                                                 streams_info_table);
 
+    const auto workStealing = config.streamExecutorConfig.get_work_stealing();
+    const auto starvationTimeout = config.streamExecutorConfig.get_starvation_timeout();
     config.streamExecutorConfig = IStreamsExecutor::Config{"CPUStreamsExecutor",
                                                            config.streams,
                                                            config.threadsPerStream,
@@ -1446,6 +1449,8 @@ std::vector<std::vector<int>> generate_stream_info(const int streams,
                                                            std::move(streams_info_table),
                                                            {},
                                                            false};
+    config.streamExecutorConfig.set_property({{ov::internal::streams_work_stealing.name(), workStealing},
+                                              {ov::internal::streams_starvation_timeout.name(), starvationTimeout}});
     return proc_type_table;
 }
 
@@ -248,6 +248,7 @@ static const TypeToNameMap& get_type_to_name_tbl() {
         {"Interaction", Type::Interaction},
         {"Unique", Type::Unique},
         {"Ngram", Type::Ngram},
+        {"SpeculativeAccept", Type::SpeculativeAccept},
         {"ScaledDotProductAttention", Type::ScaledDotProductAttention},
         {"ScaledDotProductAttentionWithKVCache", Type::ScaledDotProductAttention},
         {"SDPAWithTransposeReshape", Type::ScaledDotProductAttention},
@@ -392,6 +393,7 @@ std::string NameFromType(const Type type) {
         CASE(RandomUniform);
         CASE(Unique);
         CASE(Ngram);
+        CASE(SpeculativeAccept);
         CASE(ScaledDotProductAttention);
         CASE(PagedAttention);
         CASE(PaKVReorder);
@@ -306,8 +306,13 @@ bool DnnlExtensionUtils::isUnarySupportedAsPostOp([[maybe_unused]] Algorithm alg
 
 std::string DnnlExtensionUtils::computeWeightsStringHash(const std::shared_ptr<const IMemory>& memory,
                                                          const std::shared_ptr<DnnlMemoryDesc>& dstDesc) {
+    return computeWeightsStringHash(std::to_string(reinterpret_cast<uint64_t>(memory->getData())), dstDesc);
+}
+
+std::string DnnlExtensionUtils::computeWeightsStringHash(const std::string& weightsKey,
+                                                         const std::shared_ptr<DnnlMemoryDesc>& dstDesc) {
     const auto desc_hash = dnnl::impl::primitive_hashing::get_md_hash(*dstDesc->getDnnlDesc().get());
-    return std::to_string(desc_hash) + "_" + std::to_string(reinterpret_cast<uint64_t>(memory->getData()));
+    return std::to_string(desc_hash) + "_" + weightsKey;
 }
 
 }  // namespace ov::intel_cpu
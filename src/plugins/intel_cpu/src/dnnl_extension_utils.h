@@ -130,6 +130,15 @@ public:
      */
     static std::string computeWeightsStringHash(const std::shared_ptr<const IMemory>& memory,
                                                 const std::shared_ptr<DnnlMemoryDesc>& dstDesc);
+
+    /**
+     * @brief Computes weights string hash based on weights key and requested descriptor
+     * @param weightsKey key identifying the weights data, see WeightsSharing::weightsKey()
+     * @param dstDesc descriptor defining weights representation after repacking
+     * @return string hash
+     */
+    static std::string computeWeightsStringHash(const std::string& weightsKey,
+                                                const std::shared_ptr<DnnlMemoryDesc>& dstDesc);
 };
 
 }  // namespace ov::intel_cpu
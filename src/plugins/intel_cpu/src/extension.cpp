@@ -106,6 +106,7 @@
 #include "transformations/cpu_opset/common/op/power_static.hpp"
 #include "transformations/cpu_opset/common/op/read_value_with_subgraph.hpp"
 #include "transformations/cpu_opset/common/op/sdpa.hpp"
+#include "transformations/cpu_opset/common/op/speculative_accept.hpp"
 #include "transformations/cpu_opset/common/op/swish_cpu.hpp"
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64) || defined(OPENVINO_ARCH_RISCV64)
 #    include "transformations/snippets/common/op/load_convert.hpp"
@@ -194,6 +195,7 @@ OPENVINO_CREATE_EXTENSIONS(std::vector<ov::Extension::Ptr>({
     std::make_shared<ov::OpExtension<ov::intel_cpu::SwishNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::SDPAWithTransposeReshape>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::NgramNode>>(),
+    std::make_shared<ov::OpExtension<ov::intel_cpu::SpeculativeAcceptNode>>(),
     std::make_shared<ov::OpExtension<ov::intel_cpu::ReadValueWithSubgraph>>(),
     std::make_shared<ov::OpExtension<ov::op::internal::GatherCompressed>>(),
     std::make_shared<ov::OpExtension<ov::op::internal::NonMaxSuppressionIEInternal>>(),
@@ -24,6 +24,7 @@
 #include <new>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
+#include <optional>
 #include <set>
 #include <string>
 #include <tuple>
@@ -49,6 +50,7 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/convert.h"
 #include "nodes/input.h"
+#include "nodes/lora.h"
 #include "nodes/memory.hpp"
 #include "nodes/reorder.h"
 #include "nodes/subgraph.h"
@@ -86,6 +88,7 @@
 
 #if OV_THREAD_USE_TBB
 #    include <tbb/task.h>
+#    include <tbb/task_group.h>
 #endif
 
 #if defined(OPENVINO_ARCH_X86_64) && defined(__linux__)
@@ -336,6 +339,16 @@ static std::vector<size_t> IdentifySyncPoints(const std::vector<NodePtr>& graphN
     return syncNodesInds;
 }
 
+static bool IsExecutedAtRuntime(const NodePtr& node) {
+    const bool staticZeroDims = !node->isDynamicNode() && !node->isExecutable() && !node->isInPlace();
+    const bool dynamicNonInputOutput = node->isDynamicNode() && none_of(node->getType(), Type::Input, Type::Output);
+
+    return !node->isConstant() &&  // constants are executed once in scope of compile_model
+           !staticZeroDims &&      // never execute static nodes with zero dim input / output tensors
+           (CPU_DEBUG_CAPS_ALWAYS_TRUE(!node->neverExecute()) ||  // execute all executable nodes
+            dynamicNonInputOutput);                               // plus dynamic ones, except inputs / outputs
+}
+
 static std::tuple<std::vector<NodePtr>, std::vector<size_t>> ExtractExecutableNodesAndSyncPoints(
     const std::vector<size_t>& syncNodesInds,
     const std::vector<NodePtr>& graphNodes) {
@@ -344,13 +357,7 @@ static std::tuple<std::vector<NodePtr>, std::vector<size_t>> ExtractExecutableNo
     std::vector<NodePtr> executableGraphNodes;
     for (size_t i = 0; i < graphNodes.size(); i++) {
         const auto& node = graphNodes[i];
-        const bool staticZeroDims = !node->isDynamicNode() && !node->isExecutable() && !node->isInPlace();
-        const bool dynamicNonInputOutput = node->isDynamicNode() && none_of(node->getType(), Type::Input, Type::Output);
-
-        if (!node->isConstant() &&  // constants are executed once in scope of compile_model
-            !staticZeroDims &&      // never execute static nodes with zero dim input / output tensors
-            (CPU_DEBUG_CAPS_ALWAYS_TRUE(!node->neverExecute()) ||  // execute all executable nodes
-             dynamicNonInputOutput)) {                             // plus dynamic ones, except inputs / outputs
+        if (IsExecutedAtRuntime(node)) {
             graphIdToExecutableId[i] = executableGraphNodes.size();
             executableGraphNodes.emplace_back(node);
         }
@@ -389,6 +396,19 @@ void Graph::Init(const std::shared_ptr<const ov::Model>& model,
 
     Replicate(model, inputConfigs, outputConfigs);
 
+    // the LoRA nodes of the model selecting the adapters per batch element (see LoraAdapters) must support it, which
+    // is checked before their layouts are selected
+    const auto& inputs = model->inputs();
+    if (std::any_of(inputs.begin(), inputs.end(), [](const ov::Output<const ov::Node>& input) {
+            return input.get_names().count(LORA_ADAPTER_IDS_INPUT) != 0;
+        })) {
+        for (const auto& node : graphNodes) {
+            if (node->getType() == Type::LoRA) {
+                std::static_pointer_cast<node::LoRA>(node)->enableMultipleAdapters();
+            }
+        }
+    }
+
     Configure();
 }
 
@@ -561,7 +581,19 @@ void Graph::CreatePrimitivesAndExecConstants() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    // the nodes executed concurrently must not share a scratch pad
+    std::unordered_map<NodePtr, size_t> nodeLanes;
+    for (size_t i = 0; i < m_interOpNodes.size(); i++) {
+        nodeLanes[m_executableGraphNodes[i]] = m_interOpNodes[i].lane;
+    }
+
     for (const auto& node : graphNodes) {
+        std::optional<GraphContext::ScratchPadLaneScope> laneScope;
+        if (!nodeLanes.empty()) {
+            auto it = nodeLanes.find(node);
+            laneScope.emplace(it != nodeLanes.end() ? it->second : 0);
+        }
+
         {
             OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, node->profiling.createPrimitive);
             DEBUG_LOG(*node);
@@ -904,6 +936,14 @@ std::vector<size_t> Graph::CreateExecutionGraph() {
     std::tie(m_executableGraphNodes, m_executableSyncNodesInds) =
         ExtractExecutableNodesAndSyncPoints(syncNodesInds, graphNodes);
 
+    m_loraNodes.clear();
+    std::copy_if(m_executableGraphNodes.begin(),
+                 m_executableGraphNodes.end(),
+                 std::back_inserter(m_loraNodes),
+                 [](const NodePtr& node) {
+                     return node->getType() == Type::LoRA;
+                 });
+
     if (hasDynNodes) {
         status = Status::ReadyDynamic;
         // Here we use the following heuristic: if the number of sync nodes is less than 10 times of the number of exec
@@ -1051,7 +1091,8 @@ static void ValidateEdgeClusters(const EdgeClusters& clusters, size_t remaining)
 
 static MemoryRegions FormMemoryRegions(const EdgeClusters& clusters,
                                        size_t remaining,
-                                       const GlobalExecutionIndex& globalExecIndex) {
+                                       const GlobalExecutionIndex& globalExecIndex,
+                                       const GlobalExecutionIndex& concurrentExecIndex) {
     auto isConstOutput = [](const EdgePtr& edge) {
         return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
     };
@@ -1090,6 +1131,13 @@ static MemoryRegions FormMemoryRegions(const EdgeClusters& clusters,
                                                                : globalExecIndex.at(parent).second;
             int e_finish = usesInOutMemoryMultipleTimes(child) ? globalExecIndex.at(child).second
                                                                : globalExecIndex.at(child).first;
+            // the memory must not be reused by the nodes executed concurrently with the parent or the child
+            for (const auto& node : {parent, child}) {
+                if (auto it = concurrentExecIndex.find(node); it != concurrentExecIndex.end()) {
+                    e_start = std::min(e_start, it->second.first);
+                    e_finish = std::max(e_finish, it->second.second);
+                }
+            }
 
             auto&& desc = edge->getOriginalDesc();
 
@@ -1172,7 +1220,10 @@ static std::tuple<MemoryControl::MemorySolution, EdgeClusters, Graph::OutputMemo
     Graph::OutputMemoryBlocks outputNodesMemBlocks;
     std::tie(remaining, outputNodesMemBlocks) = AllocateDynamicOutputEdges(edgeClusters, remaining, outputNodes);
 
-    auto memoryRegions = FormMemoryRegions(edgeClusters, remaining, allocationContext.execIndex);
+    auto memoryRegions = FormMemoryRegions(edgeClusters,
+                                           remaining,
+                                           allocationContext.execIndex,
+                                           allocationContext.concurrentExecIndex);
 
     memoryControl->insert(memoryRegions, allocationContext.syncPoints);
     auto memoryBlocks = memoryControl->solve();
@@ -1180,6 +1231,279 @@ static std::tuple<MemoryControl::MemorySolution, EdgeClusters, Graph::OutputMemo
     return std::make_tuple(memoryBlocks, edgeClusters, outputNodesMemBlocks);
 }
 
+Graph::ExecutionDependencies Graph::CollectExecutionDependencies() const {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "Graph::CollectExecutionDependencies");
+
+    // a node modifying its input in place must be executed after the other consumers of the input
+    std::unordered_map<NodePtr, std::vector<NodePtr>> inPlaceDependencies;
+    for (const auto& edge : graphEdges) {
+        const auto portChildEdges = edge->getParent()->getChildEdgesAtPort(edge->getInputNum());
+        if (portChildEdges.size() < 2) {
+            continue;
+        }
+        if (auto modifyingNode = edge->modifiedInPlace()) {
+            for (const auto& peerEdge : portChildEdges) {
+                if (peerEdge != edge) {
+                    peerEdge->collectConsumers(inPlaceDependencies[modifyingNode]);
+                }
+            }
+        }
+    }
+
+    ExecutionDependencies dependencies;
+    // the last memory node and the nodes following it
+    NodePtr barrier;
+    std::vector<NodePtr> barrierFollowers;
+    for (const auto& node : graphNodes) {
+        auto& nodeDependencies = dependencies[node];
+        auto addDependency = [&](const NodePtr& dependency) {
+            if (dependency != node && dependencies.count(dependency) != 0) {
+                nodeDependencies.push_back(dependency);
+            }
+        };
+        if (any_of(node->getType(), Type::MemoryInput, Type::MemoryOutput)) {
+            if (barrier) {
+                addDependency(barrier);
+            }
+            for (const auto& follower : barrierFollowers) {
+                addDependency(follower);
+            }
+            barrier = node;
+            barrierFollowers.clear();
+        } else if (!node->isConstant()) {
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                addDependency(node->getParentEdgeAt(i)->getParent());
+            }
+            if (auto it = inPlaceDependencies.find(node); it != inPlaceDependencies.end()) {
+                for (const auto& dependency : it->second) {
+                    addDependency(dependency);
+                }
+            }
+            if (barrier) {
+                addDependency(barrier);
+            }
+            barrierFollowers.push_back(node);
+        }
+    }
+
+    return dependencies;
+}
+
+std::vector<int> Graph::SortByExecutionLevels(const ExecutionDependencies& dependencies) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "Graph::SortByExecutionLevels");
+
+    // a node is placed on the level following the levels of its dependencies
+    // the nodes not executed at runtime stay on the level of their inputs, the constants and inputs get level -1
+    std::unordered_map<NodePtr, int> nodeLevels;
+    int maxLevel = -1;
+    for (const auto& node : graphNodes) {
+        int level = -1;
+        if (any_of(node->getType(), Type::MemoryInput, Type::MemoryOutput)) {
+            level = maxLevel + 1;
+        } else if (!node->isConstant()) {
+            for (const auto& dependency : dependencies.at(node)) {
+                level = std::max(level, nodeLevels.at(dependency));
+            }
+            if (IsExecutedAtRuntime(node)) {
+                level++;
+            }
+        }
+        nodeLevels[node] = level;
+        maxLevel = std::max(maxLevel, level);
+    }
+
+    // stable sort keeps the topological order within a level
+    std::stable_sort(graphNodes.begin(), graphNodes.end(), [&nodeLevels](const NodePtr& lhs, const NodePtr& rhs) {
+        return nodeLevels.at(lhs) < nodeLevels.at(rhs);
+    });
+
+    std::vector<int> levels;
+    levels.reserve(graphNodes.size());
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        graphNodes[i]->execIndex = static_cast<int>(i);
+        levels.push_back(nodeLevels.at(graphNodes[i]));
+    }
+
+    return levels;
+}
+
+void Graph::FormInterOpSchedule(const ExecutionDependencies& dependencies,
+                                const std::vector<int>& levels,
+                                AllocationContext& context) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "Graph::FormInterOpSchedule");
+
+    m_interOpNodes.clear();
+    const size_t numNodes = m_executableGraphNodes.size();
+    std::unordered_map<NodePtr, size_t> executableIds;
+    for (size_t i = 0; i < numNodes; i++) {
+        executableIds[m_executableGraphNodes[i]] = i;
+    }
+
+    // the executable nodes a node depends on, the nodes not executed at runtime pass the dependencies through
+    std::unordered_map<NodePtr, std::vector<size_t>> sources;
+    std::vector<std::vector<size_t>> predecessors(numNodes);
+    std::map<int, size_t> levelSizes;
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        const auto& node = graphNodes[i];
+        std::vector<size_t> nodeSources;
+        for (const auto& dependency : dependencies.at(node)) {
+            const auto& dependencySources = sources.at(dependency);
+            nodeSources.insert(nodeSources.end(), dependencySources.begin(), dependencySources.end());
+        }
+        std::sort(nodeSources.begin(), nodeSources.end());
+        nodeSources.erase(std::unique(nodeSources.begin(), nodeSources.end()), nodeSources.end());
+        if (auto it = executableIds.find(node); it != executableIds.end()) {
+            predecessors[it->second] = std::move(nodeSources);
+            sources[node] = {it->second};
+            levelSizes[levels[i]]++;
+        } else {
+            sources[node] = std::move(nodeSources);
+        }
+    }
+
+    size_t maxLevelSize = 0;
+    for (const auto& levelSize : levelSizes) {
+        maxLevelSize = std::max(maxLevelSize, levelSize.second);
+    }
+    const auto numLanes = std::min(maxLevelSize, getConfig().interOpParallelism);
+    if (numLanes < 2) {
+        // nothing to execute concurrently
+        return;
+    }
+
+    m_laneStreams.assign(1, m_stream);
+    for (size_t lane = 1; lane < numLanes; lane++) {
+        m_laneStreams.push_back(make_stream(getEngine(), m_context->getCpuParallel()->get_thread_pool()));
+    }
+
+    std::vector<int> executableLevels(numNodes);
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        if (auto it = executableIds.find(graphNodes[i]); it != executableIds.end()) {
+            executableLevels[it->second] = levels[i];
+        }
+    }
+
+    // a node continues the lane of a dependency if the dependency is the last node of the lane, otherwise it is
+    // appended to the lane which last node is likely executed the earliest (has the lowest level)
+    m_interOpNodes.resize(numNodes);
+    constexpr auto noNode = std::numeric_limits<size_t>::max();
+    std::vector<size_t> laneLastNodes(numLanes, noNode);
+    for (size_t i = 0; i < numNodes; i++) {
+        auto& nodePredecessors = predecessors[i];
+        auto isPredecessor = [&nodePredecessors](size_t node) {
+            return std::binary_search(nodePredecessors.begin(), nodePredecessors.end(), node);
+        };
+        auto lane = std::find_if(laneLastNodes.begin(), laneLastNodes.end(), isPredecessor);
+        if (lane == laneLastNodes.end()) {
+            lane = std::min_element(laneLastNodes.begin(), laneLastNodes.end(), [&](size_t lhs, size_t rhs) {
+                if (rhs == noNode) {
+                    return false;
+                }
+                return lhs == noNode || executableLevels[lhs] < executableLevels[rhs];
+            });
+        }
+        // the nodes of a lane are executed one after another
+        if (*lane != noNode && !isPredecessor(*lane)) {
+            nodePredecessors.insert(std::upper_bound(nodePredecessors.begin(), nodePredecessors.end(), *lane), *lane);
+        }
+        *lane = i;
+        m_interOpNodes[i].lane = static_cast<size_t>(std::distance(laneLastNodes.begin(), lane));
+        m_interOpNodes[i].numDependencies = nodePredecessors.size();
+        for (const auto predecessor : nodePredecessors) {
+            m_interOpNodes[predecessor].successors.push_back(i);
+        }
+    }
+
+    // the nodes which are neither ancestors nor descendants of a node may be executed concurrently with it
+    const size_t numWords = (numNodes + 63) / 64;
+    auto setBit = [](uint64_t* bits, size_t i) {
+        bits[i / 64] |= uint64_t{1} << (i % 64);
+    };
+    std::vector<uint64_t> ancestors(numNodes * numWords, 0);
+    for (size_t i = 0; i < numNodes; i++) {
+        auto* nodeAncestors = &ancestors[i * numWords];
+        for (const auto predecessor : predecessors[i]) {
+            const auto* predecessorAncestors = &ancestors[predecessor * numWords];
+            for (size_t w = 0; w < numWords; w++) {
+                nodeAncestors[w] |= predecessorAncestors[w];
+            }
+            setBit(nodeAncestors, predecessor);
+        }
+    }
+    std::vector<uint64_t> descendants(numNodes * numWords, 0);
+    for (size_t i = numNodes; i-- > 0;) {
+        auto* nodeDescendants = &descendants[i * numWords];
+        for (const auto successor : m_interOpNodes[i].successors) {
+            const auto* successorDescendants = &descendants[successor * numWords];
+            for (size_t w = 0; w < numWords; w++) {
+                nodeDescendants[w] |= successorDescendants[w];
+            }
+            setBit(nodeDescendants, successor);
+        }
+    }
+
+    // the execution index range of the nodes which may be executed concurrently with each executable node
+    std::vector<std::pair<int, int>> nodeRanges;
+    std::vector<std::pair<int, int>> concurrentRanges;
+    nodeRanges.reserve(numNodes);
+    concurrentRanges.reserve(numNodes);
+    for (size_t i = 0; i < numNodes; i++) {
+        auto concurrent = [&](size_t w) {
+            auto bits = ~(ancestors[i * numWords + w] | descendants[i * numWords + w]);
+            if (w == i / 64) {
+                bits &= ~(uint64_t{1} << (i % 64));
+            }
+            if (w == numWords - 1 && numNodes % 64 != 0) {
+                bits &= (uint64_t{1} << (numNodes % 64)) - 1;
+            }
+            return bits;
+        };
+        const auto& execIndex = context.execIndex.at(m_executableGraphNodes[i]);
+        nodeRanges.push_back(execIndex);
+        auto range = execIndex;
+        for (size_t w = 0; w < numWords; w++) {
+            if (const auto bits = concurrent(w)) {
+                size_t bit = 0;
+                while ((bits & (uint64_t{1} << bit)) == 0) {
+                    bit++;
+                }
+                range.first = std::min(range.first, context.execIndex.at(m_executableGraphNodes[w * 64 + bit]).first);
+                break;
+            }
+        }
+        for (size_t w = numWords; w-- > 0;) {
+            if (const auto bits = concurrent(w)) {
+                size_t bit = 63;
+                while ((bits & (uint64_t{1} << bit)) == 0) {
+                    bit--;
+                }
+                range.second =
+                    std::max(range.second, context.execIndex.at(m_executableGraphNodes[w * 64 + bit]).second);
+                break;
+            }
+        }
+        concurrentRanges.push_back(range);
+    }
+
+    // the memory of any node executed within an executable node (including the nodes of its inner graphs) is kept
+    // while the nodes concurrent with the executable node may be executed
+    for (const auto& [node, execIndex] : context.execIndex) {
+        auto it = std::upper_bound(nodeRanges.begin(),
+                                   nodeRanges.end(),
+                                   execIndex.first,
+                                   [](int index, const std::pair<int, int>& range) {
+                                       return index < range.first;
+                                   });
+        if (it == nodeRanges.begin() || execIndex.first > std::prev(it)->second) {
+            continue;
+        }
+        const auto& range = concurrentRanges[std::distance(nodeRanges.begin(), std::prev(it))];
+        if (range != *std::prev(it)) {
+            context.concurrentExecIndex[node] = range;
+        }
+    }
+}
+
 void Graph::Allocate() {
     auto memoryControl = m_context->getMemoryControl();
 
@@ -1187,9 +1511,23 @@ void Graph::Allocate() {
         return;  // memory is already allocated globally
     }
 
+    // the nodes of a static graph can be executed concurrently (the nodes are dispatched as TBB tasks), which has
+    // to be known to the memory reuse
+    const bool interOpParallelism = OV_THREAD_USE_TBB && getConfig().interOpParallelism > 1 && !ProcessDynNodes();
+    ExecutionDependencies dependencies;
+    std::vector<int> levels;
+    if (interOpParallelism) {
+        dependencies = CollectExecutionDependencies();
+        levels = SortByExecutionLevels(dependencies);
+    }
+
     AllocationContext allocationContext;
     RegisterToAllocationContext(0, allocationContext);
 
+    if (interOpParallelism) {
+        FormInterOpSchedule(dependencies, levels, allocationContext);
+    }
+
     const auto& edges = allocationContext.edges;
     InitEdgeStatus(edges);
 
@@ -1609,19 +1947,29 @@ public:
     OV_ITT_SCOPED_TASK_BASE(ittScope, (node)->perfCounters().execute); \
     DEBUG_LOG(*(node));
 
-inline void Graph::ExecuteNode(const NodePtr& node, SyncInferRequest* request, int numaId) const {
+inline void Graph::ExecuteNode(const NodePtr& node,
+                               const dnnl::stream& stream,
+                               SyncInferRequest* request,
+                               int numaId) const {
     if (request) {
         request->throw_if_canceled();
     }
 
-    node->execute(m_stream, numaId);
+    node->execute(stream, numaId);
 }
 
 inline void Graph::ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request, int numaId) const {
+    ExecuteNodeWithCatch(node, m_stream, request, numaId);
+}
+
+inline void Graph::ExecuteNodeWithCatch(const NodePtr& node,
+                                        const dnnl::stream& stream,
+                                        SyncInferRequest* request,
+                                        int numaId) const {
     VERBOSE_PERF_DUMP_ITT_DEBUG_LOG(itt::domains::ov_op_cpu_exec, node, getConfig());
 
     try {
-        ExecuteNode(node, request, numaId);
+        ExecuteNode(node, stream, request, numaId);
     } catch (const ov::Cancelled&) {
         throw;
     } catch (const std::exception& exp) {
@@ -1643,6 +1991,55 @@ void Graph::InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&&
     }
 }
 
+void Graph::InferStaticInterOp(SyncInferRequest* request, int numaId) {
+#if OV_THREAD_USE_TBB
+    // the number of the unexecuted dependencies of each node, a node is dispatched once it drops to zero
+    std::vector<std::atomic<size_t>> dependencies(m_interOpNodes.size());
+    for (size_t i = 0; i < m_interOpNodes.size(); i++) {
+        dependencies[i].store(m_interOpNodes[i].numDependencies, std::memory_order_relaxed);
+    }
+    // after a failure the remaining nodes are not executed, but the counters are still updated
+    std::atomic<bool> failed{false};
+    std::exception_ptr exception;
+
+    // the tasks are executed in the arena of the stream the inference is called on, the nodes parallelize their
+    // kernels within the same arena
+    tbb::task_group tasks;
+    std::function<void(size_t)> dispatch = [&](size_t i) {
+        tasks.run([&, i] {
+            const auto& interOpNode = m_interOpNodes[i];
+            if (!failed.load(std::memory_order_acquire)) {
+                try {
+                    GraphContext::ScratchPadLaneScope laneScope(interOpNode.lane);
+                    ExecuteNodeWithCatch(m_executableGraphNodes[i], m_laneStreams[interOpNode.lane], request, numaId);
+                } catch (...) {
+                    if (!failed.exchange(true, std::memory_order_acq_rel)) {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+            for (const auto successor : interOpNode.successors) {
+                if (dependencies[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    dispatch(successor);
+                }
+            }
+        });
+    };
+    for (size_t i = 0; i < m_interOpNodes.size(); i++) {
+        if (m_interOpNodes[i].numDependencies == 0) {
+            dispatch(i);
+        }
+    }
+    tasks.wait();
+
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+#else
+    InferStatic(request, numaId);
+#endif
+}
+
 static int GetNumaNodeId([[maybe_unused]] const GraphContext::CPtr& context) {
     int numaNodeId = -1;
 #if defined(OPENVINO_ARCH_X86_64) && defined(__linux__)
@@ -1659,6 +2056,10 @@ void Graph::Infer(SyncInferRequest* request) {
     const int numaId = GetNumaNodeId(m_context);
 
     m_context->allocateMemory();
+    if (request != nullptr) {
+        // the inner graphs are executed without a request and share the memory control with the outer graph
+        m_context->getMemoryControl()->registerInference();
+    }
 
     switch (status) {
     case Status::ReadyDynamic:
@@ -1668,7 +2069,11 @@ void Graph::Infer(SyncInferRequest* request) {
         InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes));
         break;
     case Status::ReadyStatic:
-        InferStatic(request, numaId);
+        if (m_interOpNodes.empty()) {
+            InferStatic(request, numaId);
+        } else {
+            InferStaticInterOp(request, numaId);
+        }
         break;
     default:
         OPENVINO_ASSERT(IsReady(),
@@ -1676,6 +2081,10 @@ void Graph::Infer(SyncInferRequest* request) {
                         static_cast<int>(status));
     }
 
+    if (request != nullptr) {
+        m_context->getMemoryControl()->finishInference();
+    }
+
     if (infer_count != -1) {
         infer_count++;
     }
@@ -2240,4 +2649,10 @@ void Graph::assignStates(const std::vector<MemStatePtr>& states) {
     }
 }
 
+void Graph::assignLoraAdapters(const LoraAdaptersCPtr& adapters) {
+    for (const auto& lora : m_loraNodes) {
+        std::static_pointer_cast<node::LoRA>(lora)->setAdapters(adapters);
+    }
+}
+
 }  // namespace ov::intel_cpu
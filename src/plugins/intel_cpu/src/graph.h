@@ -17,6 +17,7 @@
 #include "config.h"
 #include "edge.h"
 #include "graph_context.h"
+#include "lora_adapters.hpp"
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_state.h"
 #include "node.h"
@@ -154,6 +155,8 @@ public:
 
     std::vector<MemStatePtr> memoryStates() const;
     void assignStates(const std::vector<MemStatePtr>& state);
+    // the adapters selection of the multi-adapter LoRA nodes, nullptr for the single adapter mode
+    void assignLoraAdapters(const LoraAdaptersCPtr& adapters);
 
     void GetPerfData(std::vector<ov::ProfilingInfo>& perfMap) const;
 
@@ -297,6 +300,7 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         m_executableSyncNodesInds.clear();
+        m_interOpNodes.clear();
     }
     Status status{Status::NotReady};
 
@@ -340,15 +344,62 @@ protected:
     void ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
 
     /**
-     * Execute a given \p node within \p request using \p numaId
+     * Execute a given \p node on \p stream within \p request using \p numaId
+     * and catch possible exceptions to include extra information
      *
      * @params node     Node to execute
+     * @params stream   Stream to execute the node on
      * @params request  Current inference request, which is checked for cancelation
      * @params numaId   Numa Id to be used for an execution
      */
-    void ExecuteNode(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
+    void ExecuteNodeWithCatch(const NodePtr& node,
+                              const dnnl::stream& stream,
+                              SyncInferRequest* request,
+                              int numaId) const;
+
+    /**
+     * Execute a given \p node on \p stream within \p request using \p numaId
+     *
+     * @params node     Node to execute
+     * @params stream   Stream to execute the node on
+     * @params request  Current inference request, which is checked for cancelation
+     * @params numaId   Numa Id to be used for an execution
+     */
+    void ExecuteNode(const NodePtr& node, const dnnl::stream& stream, SyncInferRequest* request, int numaId) const;
+
+    using ExecutionDependencies = std::unordered_map<NodePtr, std::vector<NodePtr>>;
+
+    /**
+     * Collects the nodes each node has to be executed after: the producers of its inputs, the other consumers of an
+     * input it modifies in place and the memory nodes, which are synchronized via the states rather than the edges, so
+     * they are executed alone. Only the preceding nodes are collected, so the dependencies follow the current order.
+     */
+    ExecutionDependencies CollectExecutionDependencies() const;
+
+    /**
+     * Reorders the nodes by the levels of the dependency graph, so the nodes which can be executed concurrently
+     * are adjacent. The order stays topological.
+     *
+     * @return the levels of the reordered nodes
+     */
+    std::vector<int> SortByExecutionLevels(const ExecutionDependencies& dependencies);
+
+    /**
+     * Forms the dependency graph of the executable nodes, which are dispatched once their dependencies are executed,
+     * and assigns the nodes to the lanes. The nodes of a lane are executed one after another, so they share the dnnl
+     * stream and the scratch pad of the lane. Extends the lifetime of the memory used by a node in the allocation
+     * \p context to the execution indices of the nodes which may be executed concurrently with it.
+     *
+     * @params dependencies  Dependencies of the graph nodes
+     * @params levels        Levels of the graph nodes
+     * @params context       Allocation context the graph is registered in
+     */
+    void FormInterOpSchedule(const ExecutionDependencies& dependencies,
+                             const std::vector<int>& levels,
+                             AllocationContext& context);
 
     void InferStatic(SyncInferRequest* request, int numaId);
+    void InferStaticInterOp(SyncInferRequest* request, int numaId);
     template <typename UpdateStrategy>
     void InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&& update);
 
@@ -371,9 +422,19 @@ private:
     // non-executable (optimized out) nodes, such as Input, Reshape, etc.
     std::vector<NodePtr> m_executableGraphNodes;
     std::vector<size_t> m_executableSyncNodesInds;
+    // a node of the inter-op parallel execution (see FormInterOpSchedule), indexed as m_executableGraphNodes
+    struct InterOpNode {
+        size_t lane = 0;
+        size_t numDependencies = 0;
+        std::vector<size_t> successors;
+    };
+    std::vector<InterOpNode> m_interOpNodes;
+    std::vector<NodePtr> m_loraNodes;
 
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
+    // the streams of the inter-op parallel lanes, the first one is m_stream
+    std::vector<dnnl::stream> m_laneStreams;
 };
 
 using GraphPtr = std::shared_ptr<Graph>;
@@ -4,6 +4,7 @@
 #include "graph_context.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <utility>
@@ -30,7 +31,7 @@ GraphContext::GraphContext(Config config,
                            std::shared_ptr<SubMemoryManager> sub_memory_manager)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
-      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
+      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity, true)),
       m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
       m_isGraphQuantizedFlag(isGraphQuantized),
       m_streamExecutor(std::move(streamExecutor)),
@@ -38,7 +39,8 @@ GraphContext::GraphContext(Config config,
       m_subMemoryManager(std::move(sub_memory_manager)),
 
       m_memoryStatesRegister(std::make_shared<node::MemoryStatesRegister>()),
-      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>()),
+      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>(m_config.dynamicMemoryGrowthFactor,
+                                                                            m_config.dynamicMemoryArenaLimit)),
       m_memoryControl(m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main")) {
     if (m_streamExecutor) {
         m_cpuStreamExecutor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_streamExecutor);
@@ -50,9 +52,13 @@ GraphContext::GraphContext(Config config,
     }
     // primitive/executors can be shared across sub-stream
     // but scratch pad cannot be shared.
+    // the scratch pads allocate the memory on demand, so the unused lanes cost nothing
     int numaNum = std::max(m_numaNodeId + 1, m_numNumaNodes);
-    for (int i = 0; i < numaNum; i++) {
-        m_rtScratchPads.push_back(std::make_shared<DnnlScratchPad>(getEngine(), i));
+    m_rtScratchPads.resize(std::max<size_t>(m_config.interOpParallelism, 1));
+    for (auto& scratchPads : m_rtScratchPads) {
+        for (int i = 0; i < numaNum; i++) {
+            scratchPads.push_back(std::make_shared<DnnlScratchPad>(getEngine(), i));
+        }
     }
 
     if (!m_cpuParallel) {
@@ -60,6 +66,22 @@ GraphContext::GraphContext(Config config,
     }
 }
 
+namespace {
+thread_local size_t scratchPadLane = 0;
+}  // namespace
+
+GraphContext::ScratchPadLaneScope::ScratchPadLaneScope(size_t lane) : m_previousLane(scratchPadLane) {
+    scratchPadLane = lane;
+}
+
+GraphContext::ScratchPadLaneScope::~ScratchPadLaneScope() {
+    scratchPadLane = m_previousLane;
+}
+
+size_t GraphContext::getScratchPadLane() {
+    return scratchPadLane;
+}
+
 const dnnl::engine& GraphContext::getEngine() {
     static const dnnl::engine eng(dnnl::engine::kind::cpu, 0);
     return eng;
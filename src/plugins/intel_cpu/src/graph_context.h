@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <vector>
@@ -55,14 +56,43 @@ public:
         return m_snippetsParamsCache;
     }
 
+    /**
+     * @brief Returns the scratch pad of the lane selected on the calling thread (see ScratchPadLaneScope)
+     */
     [[nodiscard]] DnnlScratchPadPtr getScratchPad() const {
-        return m_rtScratchPads[m_numaNodeId];
+        return getScratchPad(m_numaNodeId, getScratchPadLane());
     }
 
-    [[nodiscard]] const std::vector<DnnlScratchPadPtr>& getScratchPads() const {
+    [[nodiscard]] DnnlScratchPadPtr getScratchPad(int numaNodeId, size_t lane) const {
+        return m_rtScratchPads[lane][numaNodeId];
+    }
+
+    /**
+     * @brief Returns the scratch pads of the lanes, each lane has a scratch pad per NUMA node
+     */
+    [[nodiscard]] const std::vector<std::vector<DnnlScratchPadPtr>>& getScratchPads() const {
         return m_rtScratchPads;
     }
 
+    /**
+     * @brief Selects the scratch pad lane of the calling thread while the object exists.
+     * The nodes executed concurrently (inter-op parallelism) cannot share a scratch pad, so the graph selects the lane
+     * of a node while its primitives are created and executed. Lane 0 is the default scratch pad.
+     */
+    class ScratchPadLaneScope {
+    public:
+        explicit ScratchPadLaneScope(size_t lane);
+        ~ScratchPadLaneScope();
+
+        ScratchPadLaneScope(const ScratchPadLaneScope&) = delete;
+        ScratchPadLaneScope& operator=(const ScratchPadLaneScope&) = delete;
+
+    private:
+        size_t m_previousLane;
+    };
+
+    [[nodiscard]] static size_t getScratchPadLane();
+
     static const dnnl::engine& getEngine();
 
     [[nodiscard]] bool isGraphQuantized() const {
@@ -121,8 +151,8 @@ private:
     DnnlScratchPadPtr m_rtScratchPad;
 
     bool m_isGraphQuantizedFlag = false;
-    // scratch pad per sub-stream
-    std::vector<DnnlScratchPadPtr> m_rtScratchPads;
+    // scratch pad per inter-op parallel lane and per sub-stream
+    std::vector<std::vector<DnnlScratchPadPtr>> m_rtScratchPads;
     // stream executor for current graph
     ov::threading::IStreamsExecutor::Ptr m_streamExecutor;
     // cpu stream executor for current graph
@@ -4,18 +4,22 @@
 
 #include "infer_request.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <functional>
 #include <map>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string_view>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "async_infer_request.h"
+#include "cache/runtime_cache_warmup.h"
 #include "compiled_model.h"
 #include "cpu_memory.h"
 #include "cpu_tensor.h"
@@ -23,10 +27,15 @@
 #include "dnnl_extension_utils.h"
 #include "edge.h"
 #include "itt.h"
+#include "kv_cache_spill.hpp"
+#include "lora_adapters.hpp"
 #include "memory_desc/cpu_blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
+#include "memory_state.h"
 #include "node.h"
+#include "nodes/kernels/scaled_attn/executor_pa_common.hpp"
+#include "nodes/paged_attn.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/node_output.hpp"
@@ -34,6 +43,7 @@
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/itt.hpp"
+#include "openvino/runtime/allocator.hpp"
 #include "openvino/runtime/isync_infer_request.hpp"
 #include "openvino/runtime/ivariable_state.hpp"
 #include "openvino/runtime/make_tensor.hpp"
@@ -48,13 +58,56 @@
 using OvString = ov::element_type_traits<ov::element::string>::value_type;
 
 namespace ov::intel_cpu {
+
+namespace {
+// Size of a block of the PagedAttention key/value cache fed by the input, zero if the input isn't such a cache or the
+// block size is not known at the compile time
+size_t paged_attention_cache_block_bytes(const NodeConstPtr& input, const ov::Output<const ov::Node>& port) {
+    using ov::Extensions::Cpu::PagedAttentionExecutor;
+    for (const auto& weak_edge : input->getChildEdges()) {
+        const auto edge = weak_edge.lock();
+        if (!edge || edge->getChild()->getType() != Type::PagedAttention ||
+            none_of(static_cast<size_t>(edge->getOutputNum()),
+                    PagedAttentionExecutor::ID_KCACHE,
+                    PagedAttentionExecutor::ID_VCACHE)) {
+            continue;
+        }
+        const auto& shape = port.get_partial_shape();
+        if (shape.rank().is_dynamic() || shape.size() < 2) {
+            return 0;
+        }
+        size_t elements = 1;
+        for (size_t i = 1; i < shape.size(); i++) {
+            if (shape[i].is_dynamic()) {
+                return 0;
+            }
+            elements *= static_cast<size_t>(shape[i].get_length());
+        }
+        return (elements * port.get_element_type().bitwidth() + 7) / 8;
+    }
+    return 0;
+}
+}  // namespace
+
 SyncInferRequest::SyncInferRequest(CompiledModelHolder compiled_model)
     : ov::ISyncInferRequest(compiled_model.compiled_model()),
       m_compiled_model(std::move(compiled_model)) {
     const auto& inputs = get_inputs();
     for (std::size_t input_index = 0; input_index < inputs.size(); input_index++) {
         m_input_ports_map[input_index] = inputs[input_index];
+        const auto& names = inputs[input_index].get_names();
+        if (names.count(LORA_ADAPTER_IDS_INPUT) != 0) {
+            m_lora_ids_port = inputs[input_index];
+        } else if (names.count(LORA_RANK_OFFSETS_INPUT) != 0) {
+            m_lora_offsets_port = inputs[input_index];
+        }
     }
+    OPENVINO_ASSERT(m_lora_ids_port.has_value() == m_lora_offsets_port.has_value(),
+                    "The model inputs ",
+                    LORA_ADAPTER_IDS_INPUT,
+                    " and ",
+                    LORA_RANK_OFFSETS_INPUT,
+                    " select the LoRA adapters together");
 
     const auto& outputs = get_outputs();
     for (std::size_t output_index = 0; output_index < outputs.size(); output_index++) {
@@ -89,6 +142,23 @@ void SyncInferRequest::redefine_memory_for_input_nodes(Graph& graph) {
     }
 }
 
+void SyncInferRequest::record_input_shapes(RuntimeCacheWarmup& warmup) {
+    // the shared records are only touched when the shapes differ from the ones this request registered last time
+    bool changed = m_recorded_shapes.size() != m_input_ports_map.size();
+    for (size_t input_index = 0; input_index < m_input_ports_map.size() && !changed; ++input_index) {
+        changed = get_tensor_ptr(m_input_ports_map.at(input_index))->get_shape() != m_recorded_shapes[input_index];
+    }
+    if (!changed) {
+        return;
+    }
+    m_recorded_shapes.clear();
+    m_recorded_shapes.reserve(m_input_ports_map.size());
+    for (size_t input_index = 0; input_index < m_input_ports_map.size(); ++input_index) {
+        m_recorded_shapes.push_back(get_tensor_ptr(m_input_ports_map.at(input_index))->get_shape());
+    }
+    warmup.record(m_recorded_shapes);
+}
+
 void SyncInferRequest::update_external_tensor_ptrs() {
     // Update it due to batched_tensors case will update input tensor
     for (const auto& input : m_input_ports_map) {
@@ -122,6 +192,10 @@ void SyncInferRequest::infer() {
         redefine_memory_for_input_nodes(graph);
     }
 
+    if (const auto& warmup = m_compiled_model.runtimeCacheWarmup(); warmup && graph.IsDynamic() && !warmup->isFull()) {
+        record_input_shapes(*warmup);
+    }
+
     change_default_ptr(graph);
 
     throw_if_canceled();
@@ -130,10 +204,16 @@ void SyncInferRequest::infer() {
     if (!m_memory_states.empty()) {
         graph.assignStates(m_memory_states);
     }
+    graph.assignLoraAdapters(lora_adapters());
 
     push_input_data(graph);
+    if (!graph.getConfig().kvCacheSpillDir.empty()) {
+        prefetch_spilled_kv_cache(graph);
+    }
+    mark_inputs_prepared();
 
     graph.Infer(this);
+    mark_graph_executed();
 
     throw_if_canceled();
 
@@ -326,6 +406,83 @@ std::vector<ov::SoPtr<ov::IVariableState>> SyncInferRequest::query_state() const
     return {m_memory_states.begin(), m_memory_states.end()};
 }
 
+void SyncInferRequest::fork_states(SyncInferRequest& source, size_t position) {
+    OPENVINO_ASSERT(&source != this, "An infer request cannot be forked from itself");
+    for (const auto& state : m_memory_states) {
+        auto source_state = std::find_if(source.m_memory_states.begin(),
+                                         source.m_memory_states.end(),
+                                         [&state](const MemStatePtr& candidate) {
+                                             return candidate->get_name() == state->get_name();
+                                         });
+        OPENVINO_ASSERT(source_state != source.m_memory_states.end(),
+                        "The source infer request has no state ",
+                        state->get_name());
+
+        auto kv_state = std::dynamic_pointer_cast<VariableStateKVcache>(state);
+        auto kv_source_state = std::dynamic_pointer_cast<VariableStateKVcache>(*source_state);
+        if (kv_state && kv_source_state) {
+            kv_state->fork_from(*kv_source_state, position);
+        } else if ((*source_state)->is_reset_state()) {
+            state->reset();
+        } else {
+            state->set_state((*source_state)->get_state());
+        }
+    }
+}
+
+void SyncInferRequest::trim_states(size_t position) {
+    for (const auto& state : m_memory_states) {
+        // the other states (e.g. of the recurrent layers) are not indexed by the tokens, so they are kept
+        if (auto kv_state = std::dynamic_pointer_cast<VariableStateKVcache>(state)) {
+            kv_state->trim(position);
+        }
+    }
+}
+
+LoraAdaptersCPtr SyncInferRequest::lora_adapters() {
+    if (!m_lora_ids_port) {
+        return nullptr;
+    }
+    const auto ids = get_tensor(*m_lora_ids_port);
+    if (ids->get_size() == 0) {
+        return nullptr;
+    }
+    const auto offsets = get_tensor(*m_lora_offsets_port);
+    OPENVINO_ASSERT(ids->get_element_type() == ov::element::i32 && offsets->get_element_type() == ov::element::i32,
+                    "The LoRA adapters must be selected by the i32 tensors");
+    OPENVINO_ASSERT(offsets->get_size() > 1, "LoRA adapters must have rank offsets of at least one adapter");
+
+    const auto* offsets_data = static_cast<const int32_t*>(offsets->data());
+    const auto* ids_data = static_cast<const int32_t*>(ids->data());
+    // the tensors may be updated in place, so the selection is compared with the one validated last time, which is
+    // reused unless it has changed
+    if (m_lora_adapters && m_lora_adapters->ids.size() == ids->get_size() &&
+        m_lora_adapters->rank_offsets.size() == offsets->get_size() &&
+        std::equal(m_lora_adapters->ids.begin(), m_lora_adapters->ids.end(), ids_data) &&
+        std::equal(m_lora_adapters->rank_offsets.begin(),
+                   m_lora_adapters->rank_offsets.end(),
+                   offsets_data,
+                   [](size_t cached, int32_t offset) {
+                       return offset >= 0 && cached == static_cast<size_t>(offset);
+                   })) {
+        return m_lora_adapters;
+    }
+
+    auto adapters = std::make_shared<LoraAdapters>();
+    for (size_t i = 0; i < offsets->get_size(); i++) {
+        OPENVINO_ASSERT(offsets_data[i] >= 0 && (i == 0 || offsets_data[i] >= offsets_data[i - 1]),
+                        "LoRA adapters rank offsets must be non-negative and non-decreasing");
+        adapters->rank_offsets.push_back(static_cast<size_t>(offsets_data[i]));
+    }
+    const auto count = static_cast<int32_t>(offsets->get_size() - 1);
+    for (size_t i = 0; i < ids->get_size(); i++) {
+        OPENVINO_ASSERT(ids_data[i] < count, "LoRA adapter ", ids_data[i], " is out of the ", count, " adapters");
+        adapters->ids.push_back(ids_data[i]);
+    }
+    m_lora_adapters = std::move(adapters);
+    return m_lora_adapters;
+}
+
 void SyncInferRequest::set_async_request(AsyncInferRequest* asyncRequest) {
     m_asyncRequest = asyncRequest;
 }
@@ -501,7 +658,19 @@ void SyncInferRequest::init_tensor(const std::size_t& port_index, const ov::ISyn
                 tensor_shape = shape.to_shape();
             }
 
-            tensor = ov::make_tensor(port.get_element_type(), tensor_shape);
+            const auto& config = graph.getConfig();
+            const auto input_node = graph.getInputNodeByIndex(port_index);
+            const auto block_bytes =
+                config.kvCacheSpillDir.empty() ? 0 : paged_attention_cache_block_bytes(input_node, port);
+            if (block_bytes != 0) {
+                // the blocks of the cache above the DRAM budget are backed by a file
+                const auto dram_bytes = config.kvCacheDramBlocks * block_bytes;
+                tensor = ov::make_tensor(port.get_element_type(),
+                                         tensor_shape,
+                                         ov::Allocator{KVCacheSpillAllocator(config.kvCacheSpillDir, dram_bytes)});
+            } else {
+                tensor = ov::make_tensor(port.get_element_type(), tensor_shape);
+            }
             ov::ISyncInferRequest::set_tensor(port, tensor);
 
             if (!isDynamic) {
@@ -596,6 +765,44 @@ void SyncInferRequest::init_tensor(const std::size_t& port_index, const ov::ISyn
     OPENVINO_ASSERT(tensor, "Cannot find tensor with index: ", port_index);
 }
 
+void SyncInferRequest::prefetch_spilled_kv_cache(Graph& graph) {
+    using ov::Extensions::Cpu::PagedAttentionExecutor;
+    // the inputs of the nodes are only updated by the graph execution, so the caches and the block indices of this
+    // inference are taken from the input tensors. All the layers are prefetched up front, so the blocks of the later
+    // layers are read while the first ones execute
+    std::unordered_map<const Node*, std::size_t> inputIndices;
+    for (const auto& input : m_input_ports_map) {
+        inputIndices[graph.getInputNodeByIndex(input.first).get()] = input.first;
+    }
+    auto inputTensor = [&](const NodePtr& node, size_t port) -> ov::SoPtr<ov::ITensor> {
+        const auto found = inputIndices.find(node->getParentEdgeAt(port)->getParent().get());
+        if (found == inputIndices.end()) {
+            return {};
+        }
+        return ov::ISyncInferRequest::get_tensor(m_input_ports_map.at(found->second));
+    };
+
+    for (const auto& node : graph.GetNodes()) {
+        if (node->getType() != Type::PagedAttention) {
+            continue;
+        }
+        const auto blocks = inputTensor(node, PagedAttentionExecutor::ID_BLOCK_INDICES);
+        if (!blocks || blocks->get_element_type() != ov::element::i32 || blocks->get_size() == 0) {
+            continue;
+        }
+        for (const auto port : {PagedAttentionExecutor::ID_KCACHE, PagedAttentionExecutor::ID_VCACHE}) {
+            const auto cache = inputTensor(node, port);
+            if (!cache || cache->get_shape().empty() || cache->get_shape()[0] == 0) {
+                continue;
+            }
+            KVCacheSpillAllocator::prefetch(cache->data(),
+                                            cache->get_byte_size() / cache->get_shape()[0],
+                                            static_cast<const int32_t*>(blocks->data()),
+                                            blocks->get_size());
+        }
+    }
+}
+
 void SyncInferRequest::push_input_data(Graph& graph) {
     for (auto& input : m_input_ports_map) {
         const auto& tensor = get_tensor_ptr(input.second);
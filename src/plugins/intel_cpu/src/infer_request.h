@@ -7,14 +7,17 @@
 #include <array>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <vector>
 
+#include "cache/runtime_cache_warmup.h"
 #include "compiled_model.h"
 #include "cpu_memory.h"
 #include "cpu_shape.h"
 #include "cpu_tensor.h"
 #include "graph.h"
+#include "lora_adapters.hpp"
 #include "memory_state.h"
 #include "openvino/core/node.hpp"
 #include "openvino/core/node_output.hpp"
@@ -63,6 +66,25 @@ public:
 
     void throw_if_canceled() const;
 
+    /**
+     * @brief Forks the states of the source infer request of the same compiled model. The KV cache states share the
+     * memory of the first `position` tokens with the source states until they are written (copy-on-write), so a
+     * shared prompt is neither recomputed nor copied upfront. The source keeps the memory. The other states are
+     * copied as is.
+     * @param[in]  source The infer request, which must not be executed concurrently
+     * @param[in]  position Number of the tokens to share
+     */
+    void fork_states(SyncInferRequest& source, size_t position);
+
+    /**
+     * @brief Drops the tokens behind the position from the KV cache states in place, so the draft tokens rejected by
+     * the speculative decoding verification are neither copied out nor recomputed. With PagedAttention the KV cache
+     * is addressed by the past lengths and the block tables passed to each inference, so lowering the past lengths
+     * does the same. The other states are kept as is.
+     * @param[in]  position Number of the tokens to keep
+     */
+    void trim_states(size_t position);
+
 private:
     class OutputControlBlock {
     public:
@@ -111,7 +133,9 @@ private:
     void init_tensor(const std::size_t& port_index, const ov::ISyncInferRequest::FoundPort::Type& type);
 
     void push_input_data(Graph& graph);
+    void prefetch_spilled_kv_cache(Graph& graph);
     void redefine_memory_for_input_nodes(Graph& graph);
+    void record_input_shapes(RuntimeCacheWarmup& warmup);
     void update_external_tensor_ptrs();
     void change_default_ptr(Graph& graph);
 
@@ -119,6 +143,9 @@ private:
 
     void sub_streams_infer();
 
+    // the LoRA adapters selected by the dedicated inputs (see LoraAdapters), nullptr for the single adapter mode
+    LoraAdaptersCPtr lora_adapters();
+
     std::unordered_map<std::size_t, OutputControlBlock> m_outputControlBlocks;
 
     std::unordered_map<std::size_t, ov::SoPtr<ov::ITensor>> m_input_external_ptr;
@@ -126,6 +153,12 @@ private:
 
     openvino::itt::handle_t m_profiling_task = nullptr;
     std::vector<MemStatePtr> m_memory_states;
+    std::optional<ov::Output<const ov::Node>> m_lora_ids_port;
+    std::optional<ov::Output<const ov::Node>> m_lora_offsets_port;
+    // the LoRA adapters selection validated last time
+    LoraAdaptersCPtr m_lora_adapters;
+    // the input shapes this request registered for the runtime cache warm up last time
+    RuntimeCacheWarmup::Record m_recorded_shapes;
     AsyncInferRequest* m_asyncRequest = nullptr;
     CompiledModelHolder m_compiled_model;
 
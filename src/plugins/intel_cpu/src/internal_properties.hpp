@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <istream>
+#include <map>
 #include <ostream>
 #include <string>
 
@@ -20,6 +21,101 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Read-only property to get the CPU runtime parameters cache statistics accumulated over all the streams of the
+ * compiled model. The keys are "HITS", "MISSES", "EVICTIONS" and "SIZE" (number of records stored at the moment).
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Path to the file which keeps the input shapes the dynamic model has been executed with. The runtime caches
+ * are warmed up with these shapes when the model is compiled or imported, new shapes are appended to the file when the
+ * compiled model is destroyed. Empty value (default) disables the feature.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> cpu_runtime_cache_warmup_file{
+    "CPU_RUNTIME_CACHE_WARMUP_FILE"};
+
+/**
+ * @brief Growth factor of the memory blocks which keep the dynamic shape tensors. When such a block has to be enlarged,
+ * at least its current size multiplied by the factor is reserved, so a tensor growing step by step (e.g. a sequence
+ * growing token by token) is reallocated a logarithmic number of times instead of on every step.
+ * Must be in range [1.0, 4.0], 1.0 (default) reserves exactly the requested size.
+ */
+static constexpr Property<float, PropertyMutability::RW> cpu_dynamic_memory_growth_factor{
+    "CPU_DYNAMIC_MEMORY_GROWTH_FACTOR"};
+
+/**
+ * @brief Max size in bytes of the per stream arena backing the memory of the dynamic shape intermediate tensors.
+ * The arena follows the high-water mark of the dynamic memory demand observed during the inferences, so it stops
+ * growing once the steady state is reached and the dynamic tensors are not allocated on the heap anymore. The tensors
+ * which don't fit into the arena are allocated on the heap. Zero (default) disables the arena.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cpu_dynamic_memory_arena_limit{
+    "CPU_DYNAMIC_MEMORY_ARENA_LIMIT"};
+
+/**
+ * @brief Enables sharing of the repacked weights between all the compiled models of the process. The repacked weights
+ * are identified by the content of the original weights, so the same model compiled several times (e.g. with different
+ * performance hints) keeps a single copy of the repacked weights, which is released with the last compiled model
+ * using it. Computing the content hash of the weights slows down the model compilation. Disabled by default.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_process_wide_weights_cache{
+    "CPU_PROCESS_WIDE_WEIGHTS_CACHE"};
+
+/**
+ * @brief Max number of nodes of a static graph executed concurrently (inter-op parallelism). The nodes are assigned to
+ * this number of lanes, the nodes of a lane are executed one after another. A node is dispatched as a TBB task in the
+ * arena of the stream once the nodes it depends on are executed. Useful for the models with wide independent branches,
+ * which don't saturate the threads with the intra-op parallelism alone. The memory of the nodes which may be executed
+ * concurrently is not reused, so the memory consumption grows. One (default) executes the nodes sequentially, as well
+ * as the builds without TBB.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> cpu_inter_op_parallelism{"CPU_INTER_OP_PARALLELISM"};
+
+/**
+ * @brief Makes VariableState::get_state() of the KV cache states return the cache in the native layout of the plugin
+ * (possibly quantized, along with the beam table and the quantization parameters) instead of the model layout. Such a
+ * tensor is an opaque byte blob, which can be passed to set_state() of the same variable of any infer request of the
+ * process, so saving and restoring the state is a memory copy instead of the dequantization and reordering round trip.
+ * Disabled by default.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_kv_cache_native_state{"CPU_KV_CACHE_NATIVE_STATE"};
+
+/**
+ * @brief Makes the exported compiled model blob carry the weights already repacked for the ISA of the host, so the
+ * model imported on a host with the same ISA aliases them instead of repacking the original weights again. If the blob
+ * is imported through mmap, the repacked weights are not copied at all and the processes importing the same blob share
+ * one page cache copy of them. The blob imported on a host with another ISA falls back to the repacking.
+ * Disabled by default.
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_cache_repacked_weights{"CPU_CACHE_REPACKED_WEIGHTS"};
+
+/**
+ * @brief Directory of the files backing the spilled blocks of the PagedAttention key/value cache tensors allocated by
+ * the infer requests. Only the leading cpu_kv_cache_dram_blocks blocks of such a tensor are kept in DRAM, the blocks
+ * with the greater indices are mapped to a file, so a block manager can park the idle sequences there instead of
+ * dropping and recomputing their prefill. The spilled blocks referenced by the block indices input are prefetched
+ * asynchronously at the beginning of an inference. Empty value (default) keeps all the blocks in DRAM. Linux only.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> cpu_kv_cache_spill_dir{"CPU_KV_CACHE_SPILL_DIR"};
+
+/**
+ * @brief Number of the leading blocks of a PagedAttention key/value cache tensor kept in DRAM when
+ * cpu_kv_cache_spill_dir is set. Zero (default) backs all the blocks by the file. The split is fixed when the tensor is
+ * allocated, the page cache holding the file backed blocks in use isn't limited by it.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cpu_kv_cache_dram_blocks{"CPU_KV_CACHE_DRAM_BLOCKS"};
+
+/**
+ * @brief Minimal number of the tokens routed to an expert of a GatherMatmul (MoE) node to gather them into one GEMM
+ * with the expert weights, so the weights are read and decompressed once per expert instead of once per token. The
+ * experts with less tokens are executed token by token. 1 groups all the tokens, 0 disables the grouping. With bf16
+ * AMX any non-zero value groups all the tokens. Default is 4.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cpu_moe_grouped_gemm_min_tokens{
+    "CPU_MOE_GROUPED_GEMM_MIN_TOKENS"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
@@ -0,0 +1,198 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kv_cache_spill.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "openvino/core/except.hpp"
+
+#if defined(__linux__)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <unistd.h>
+
+#    include <cerrno>
+#    include <cstring>
+#endif
+
+namespace ov::intel_cpu {
+
+namespace {
+
+struct SpilledRegion {
+    size_t size;
+    size_t dram_bytes;
+};
+
+// The memory allocated by all the KVCacheSpillAllocator instances, so the PagedAttention nodes can recognize it
+class SpilledRegions {
+public:
+    static SpilledRegions& get() {
+        static SpilledRegions regions;
+        return regions;
+    }
+
+    void add(uintptr_t base, SpilledRegion region) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_regions[base] = region;
+    }
+
+    void remove(uintptr_t base) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_regions.erase(base);
+    }
+
+    bool find(uintptr_t address, uintptr_t& base, SpilledRegion& region) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_regions.upper_bound(address);
+        if (it == m_regions.begin()) {
+            return false;
+        }
+        --it;
+        if (address >= it->first + it->second.size) {
+            return false;
+        }
+        base = it->first;
+        region = it->second;
+        return true;
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    std::map<uintptr_t, SpilledRegion> m_regions;
+};
+
+#if defined(__linux__)
+size_t page_size() {
+    static const auto size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+size_t round_up_to_pages(size_t bytes) {
+    const auto page = page_size();
+    return (std::max<size_t>(bytes, 1) + page - 1) / page * page;
+}
+#endif
+
+}  // namespace
+
+KVCacheSpillAllocator::KVCacheSpillAllocator(std::string directory, size_t dram_bytes)
+    : m_directory(std::move(directory)),
+      m_dram_bytes(dram_bytes) {}
+
+bool KVCacheSpillAllocator::is_equal(const KVCacheSpillAllocator& other) const {
+    return m_directory == other.m_directory && m_dram_bytes == other.m_dram_bytes;
+}
+
+#if defined(__linux__)
+
+void* KVCacheSpillAllocator::allocate(size_t bytes, size_t alignment) {
+    OPENVINO_ASSERT(alignment <= page_size(), "KV cache spill allocator doesn't support alignment ", alignment);
+    const auto size = round_up_to_pages(bytes);
+    const auto dram_bytes = std::min(m_dram_bytes == 0 ? 0 : round_up_to_pages(m_dram_bytes), size);
+
+    // the address range is reserved first, so both tiers are mapped contiguously
+    auto* base =
+        static_cast<uint8_t*>(mmap(nullptr, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0));
+    OPENVINO_ASSERT(base != MAP_FAILED, "Failed to reserve ", size, " bytes for the KV cache: ", std::strerror(errno));
+    if (dram_bytes > 0 && mmap(base,
+                               dram_bytes,
+                               PROT_READ | PROT_WRITE,
+                               MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS,
+                               -1,
+                               0) == MAP_FAILED) {
+        const auto error = errno;
+        munmap(base, size);
+        OPENVINO_THROW("Failed to allocate ", dram_bytes, " bytes for the KV cache: ", std::strerror(error));
+    }
+    if (size > dram_bytes) {
+        const auto spill_bytes = size - dram_bytes;
+        auto path = (std::filesystem::path(m_directory) / "ov_kv_cache_XXXXXX").string();
+        const int fd = mkstemp(path.data());
+        if (fd < 0) {
+            const auto error = errno;
+            munmap(base, size);
+            OPENVINO_THROW("Failed to create the KV cache spill file in ", m_directory, ": ", std::strerror(error));
+        }
+        // the file lives as long as it's mapped
+        unlink(path.c_str());
+        // the space is reserved up front, a write to a sparse file on a full disk would raise SIGBUS instead
+        int error = posix_fallocate(fd, 0, static_cast<off_t>(spill_bytes));
+        if (error == 0 &&
+            mmap(base + dram_bytes, spill_bytes, PROT_READ | PROT_WRITE, MAP_FIXED | MAP_SHARED, fd, 0) == MAP_FAILED) {
+            error = errno;
+        }
+        close(fd);
+        if (error != 0) {
+            munmap(base, size);
+            OPENVINO_THROW("Failed to map ", spill_bytes, " bytes of the KV cache to a file: ", std::strerror(error));
+        }
+    }
+    SpilledRegions::get().add(reinterpret_cast<uintptr_t>(base), {size, dram_bytes});
+    return base;
+}
+
+void KVCacheSpillAllocator::deallocate(void* ptr, size_t bytes, [[maybe_unused]] size_t alignment) noexcept {
+    if (ptr == nullptr) {
+        return;
+    }
+    SpilledRegions::get().remove(reinterpret_cast<uintptr_t>(ptr));
+    munmap(ptr, round_up_to_pages(bytes));
+}
+
+size_t KVCacheSpillAllocator::prefetch(const void* data, size_t block_bytes, const int32_t* blocks, size_t count) {
+    uintptr_t base = 0;
+    SpilledRegion region{};
+    const auto address = reinterpret_cast<uintptr_t>(data);
+    if (block_bytes == 0 || !SpilledRegions::get().find(address, base, region) || region.dram_bytes == region.size) {
+        return 0;
+    }
+    const auto offset = static_cast<size_t>(address - base);
+    const auto page = page_size();
+    size_t prefetched = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (blocks[i] < 0) {
+            continue;
+        }
+        const auto begin = offset + static_cast<size_t>(blocks[i]) * block_bytes;
+        const auto end = begin + block_bytes;
+        if (end <= region.dram_bytes || end > region.size) {
+            continue;
+        }
+        const auto page_begin = std::max(begin, region.dram_bytes) / page * page;
+        // asynchronous read ahead of the file pages
+        madvise(reinterpret_cast<void*>(base + page_begin), end - page_begin, MADV_WILLNEED);
+        prefetched++;
+    }
+    return prefetched;
+}
+
+#else
+
+void* KVCacheSpillAllocator::allocate([[maybe_unused]] size_t bytes, [[maybe_unused]] size_t alignment) {
+    OPENVINO_THROW("KV cache spill to files is supported on Linux only");
+}
+
+void KVCacheSpillAllocator::deallocate([[maybe_unused]] void* ptr,
+                                       [[maybe_unused]] size_t bytes,
+                                       [[maybe_unused]] size_t alignment) noexcept {}
+
+size_t KVCacheSpillAllocator::prefetch([[maybe_unused]] const void* data,
+                                       [[maybe_unused]] size_t block_bytes,
+                                       [[maybe_unused]] const int32_t* blocks,
+                                       [[maybe_unused]] size_t count) {
+    return 0;
+}
+
+#endif
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,54 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Allocator of the PagedAttention key/value cache tensors with two tiers of blocks. The leading bytes of a
+ * tensor are anonymous memory (DRAM), the rest is backed by an unlinked file in the spill directory mapped right after
+ * them, so the tensor stays contiguous for the kernels. The file backed blocks are paged in by the OS on access and
+ * written back and evicted under the memory pressure, so the sequences parked there don't take DRAM and their prefill
+ * doesn't have to be recomputed. Supported on Linux only.
+ *
+ * The DRAM budget is the split of the tensor fixed at its allocation, it isn't enforced afterwards: the file backed
+ * blocks in use stay in the page cache as long as the OS keeps them, and as the file is a shared mapping, their dirty
+ * pages are written back to it, which is what lets the OS evict them.
+ *
+ * Satisfies the requirements of ov::Allocator.
+ */
+class KVCacheSpillAllocator {
+public:
+    /**
+     * @param directory Directory of the files backing the spilled blocks.
+     * @param dram_bytes Size of the leading part of each tensor kept in DRAM.
+     */
+    KVCacheSpillAllocator(std::string directory, size_t dram_bytes);
+
+    void* allocate(size_t bytes, size_t alignment = alignof(max_align_t));
+    void deallocate(void* ptr, size_t bytes, size_t alignment = alignof(max_align_t)) noexcept;
+    bool is_equal(const KVCacheSpillAllocator& other) const;
+
+    /**
+     * @brief Starts reading in background the file backed blocks of a tensor allocated by a KVCacheSpillAllocator,
+     * so they are in DRAM by the time the attention reaches them. Does nothing for the memory of other allocators.
+     * @param data Data of the tensor.
+     * @param block_bytes Size of a block.
+     * @param blocks Indices of the blocks.
+     * @param count Number of the indices.
+     * @return Number of the blocks which prefetching is started for.
+     */
+    static size_t prefetch(const void* data, size_t block_bytes, const int32_t* blocks, size_t count);
+
+private:
+    std::string m_directory;
+    size_t m_dram_bytes;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,37 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Selection of the LoRA adapters per batch element for the multi-adapter serving. The adapters resident in a
+ * compiled model are stacked along the rank dimension of the LoRA states (A [rank, K], alpha [1, rank],
+ * B [N, rank]), so they are loaded and unloaded by setting the states, without recompilation.
+ *
+ * The selection is passed with each inference through the dedicated model inputs (the parameters not consumed by the
+ * model operations), see LORA_ADAPTER_IDS_INPUT and LORA_RANK_OFFSETS_INPUT. The empty adapter ids tensor selects the
+ * single adapter mode, where the sum of all the stacked adapters is applied.
+ */
+struct LoraAdapters {
+    // adapter i occupies the ranks [rank_offsets[i], rank_offsets[i + 1]) of the states
+    std::vector<size_t> rank_offsets;
+    // adapter of each batch element, negative for the base model only
+    std::vector<int32_t> ids;
+};
+
+// name of the i32 [batch] model input with the adapter of each batch element
+inline constexpr const char* LORA_ADAPTER_IDS_INPUT = "lora_adapter_ids";
+// name of the i32 [adapters + 1] model input with the rank offsets of the adapters
+inline constexpr const char* LORA_RANK_OFFSETS_INPUT = "lora_rank_offsets";
+
+using LoraAdaptersCPtr = std::shared_ptr<const LoraAdapters>;
+
+}  // namespace ov::intel_cpu
@@ -5,9 +5,13 @@
 #include "memory_control.hpp"
 
 #include <algorithm>
+#include <common/utils.hpp>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <iterator>
+#include <limits>
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -67,9 +71,93 @@ private:
     ptrdiff_t m_offset = 0;
 };
 
+/**
+ * @brief A bump pointer arena backing the memory blocks of the dynamic shape tensors.
+ * The allocations are never freed individually. Instead, after each inference which has (re)allocated some blocks,
+ * the arena is reset, enlarged up to the high-water mark of that inference (but not above the limit) and the blocks
+ * are placed there again one after another. The blocks which don't fit into the arena are served by the heap. So once
+ * the demand stops growing, the dynamic blocks don't touch the heap anymore.
+ */
+class DynamicMemoryArena {
+public:
+    explicit DynamicMemoryArena(size_t limit) : m_data(nullptr, destroy), m_limit(limit) {}
+
+    void* allocate(size_t size) {
+        size = alignedSize(size);
+        if (m_offset + size > m_capacity) {
+            m_overflowed = true;
+            return nullptr;
+        }
+        void* ptr = static_cast<uint8_t*>(m_data.get()) + m_offset;
+        m_offset += size;
+        return ptr;
+    }
+
+    /**
+     * @brief Checks whether some blocks were allocated (or have not fit) since the blocks were placed last time
+     */
+    [[nodiscard]] bool changed() const {
+        return m_overflowed || m_offset != m_placedOffset;
+    }
+
+    /**
+     * @brief Drops all the allocations and enlarges the arena up to the given high-water mark
+     */
+    void reset(size_t highWaterMark) {
+        const size_t capacity = std::min(highWaterMark, m_limit);
+        if (capacity > m_capacity) {
+            m_data.reset();
+            m_data.reset(dnnl::impl::malloc(capacity, alignment));
+            OPENVINO_ASSERT(m_data, "Failed to allocate ", capacity, " bytes of memory");
+            m_capacity = capacity;
+        }
+        m_offset = 0;
+        m_placedOffset = 0;
+        m_overflowed = false;
+    }
+
+    /**
+     * @brief Marks the current allocations as the placement of the blocks, the following ones change it
+     */
+    void markPlaced() {
+        m_placedOffset = m_offset;
+        m_overflowed = false;
+    }
+
+    void release() {
+        m_data.reset();
+        m_capacity = 0;
+        m_offset = 0;
+        m_placedOffset = 0;
+        m_overflowed = false;
+    }
+
+    static size_t alignedSize(size_t size) {
+        return rnd_up(size, alignment);
+    }
+
+private:
+    static void destroy(void* ptr) {
+        dnnl::impl::free(ptr);
+    }
+
+    static constexpr size_t alignment = 64;
+
+    std::unique_ptr<void, void (*)(void*)> m_data;
+    size_t m_limit;
+    size_t m_capacity = 0;
+    size_t m_offset = 0;
+    size_t m_placedOffset = 0;
+    bool m_overflowed = false;
+};
+
+using DynamicMemoryArenaPtr = std::shared_ptr<DynamicMemoryArena>;
+
 class MemoryBlockWithRelease : public IMemoryBlockObserver {
 public:
-    MemoryBlockWithRelease() {
+    explicit MemoryBlockWithRelease(float growthFactor = 1.0F, DynamicMemoryArenaPtr arena = nullptr)
+        : m_growthFactor(growthFactor),
+          m_arena(std::move(arena)) {
         auto pInternalMem = std::make_unique<MemoryBlockWithReuse>();
         m_pInternalMem = pInternalMem.get();
         m_pBlock = std::make_shared<DnnlMemoryBlock>(std::move(pInternalMem));
@@ -82,6 +170,19 @@ public:
         m_pBlock->setExtBuff(ptr, size);
     }
     bool resize(size_t size) override {
+        const size_t currentSize = m_pInternalMem->size();
+        if (size > currentSize && currentSize > 0) {
+            // the block is being enlarged, so reserve more than requested to amortize the subsequent growth
+            const auto grownSize = static_cast<size_t>(static_cast<double>(currentSize) * m_growthFactor);
+            size = std::max(size, grownSize);
+            m_reallocations++;
+        }
+        if (size > currentSize && m_arena) {
+            if (void* ptr = m_arena->allocate(size)) {
+                m_pBlock->setExtBuff(ptr, size);
+                return true;
+            }
+        }
         return m_pBlock->resize(size);
     }
     [[nodiscard]] bool hasExtBuffer() const noexcept override {
@@ -101,9 +202,33 @@ public:
         return m_pInternalMem->size();
     }
 
+    [[nodiscard]] size_t reallocations() const {
+        return m_reallocations;
+    }
+
+    /**
+     * @brief Moves the block to the arena after its reset. The content of the block is not preserved.
+     */
+    void moveToArena() {
+        const size_t size = m_pInternalMem->size();
+        if (size == 0) {
+            return;
+        }
+        if (void* ptr = m_arena->allocate(size)) {
+            m_pBlock->setExtBuff(ptr, size);
+        } else if (m_pInternalMem->hasExtBuffer()) {
+            // the block still refers to the previous arena storage, which may be gone
+            m_pInternalMem->free();
+            m_pBlock->resize(size);
+        }
+    }
+
 private:
     MemoryBlockPtr m_pBlock;
     MemoryBlockWithReuse* m_pInternalMem;
+    float m_growthFactor;
+    DynamicMemoryArenaPtr m_arena;
+    size_t m_reallocations = 0;
 };
 
 #ifdef CPU_DEBUG_CAPS
@@ -160,6 +285,7 @@ public:
     virtual const MemoryControl::MemorySolution& lastSolution() = 0;
     virtual void allocate() = 0;
     virtual void release() = 0;
+    virtual void finishInference() = 0;
 };
 
 using MemoryManagerPtr = std::shared_ptr<IMemoryManager>;
@@ -194,6 +320,9 @@ public:
     void release() override {
         // nothing to do
     }
+    void finishInference() override {
+        // nothing to do
+    }
 
 private:
     static const char* getClassName() {
@@ -233,6 +362,7 @@ private:
         m_totalSize = static_cast<size_t>(staticMemSolver.solve()) * alignment;
 
         m_workspace = std::make_shared<MemoryBlockWithRelease>();
+        m_solves++;
 
         for (const auto& box : boxes_to_process) {
             int64_t offset = staticMemSolver.get_offset(static_cast<int>(box.id));
@@ -251,6 +381,9 @@ private:
             m_workspace->free();
         }
     }
+    void finishInference() override {
+        // nothing to do
+    }
 
     static const char* getClassName() {
         return "MemoryManagerStatic";
@@ -260,12 +393,19 @@ private:
     std::vector<MemorySolver::Box> m_boxes;
     std::shared_ptr<MemoryBlockWithRelease> m_workspace;
     size_t m_totalSize = 0;
+    size_t m_solves = 0;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj);)
 };
 
 class MemoryManagerNonOverlappingSets : public IMemoryManager {
 public:
+    MemoryManagerNonOverlappingSets(float growthFactor, size_t arenaLimit) : m_growthFactor(growthFactor) {
+        if (arenaLimit > 0) {
+            m_arena = std::make_shared<DynamicMemoryArena>(arenaLimit);
+        }
+    }
+
     void insert(const MemoryRegion& reg, const std::vector<size_t>& syncInds) override {
         MemorySolver::Box box = {reg.start, reg.finish, reg.size, reg.id};
         if (-1 != reg.finish) {
@@ -311,33 +451,46 @@ private:
     }
 #endif  // CPU_DEBUG_CAPS
 
+    // a set of boxes with non overlapping lifespans sharing the same memory block
+    struct Group {
+        [[nodiscard]] bool fits(int start, int finish) const {
+            // the lifespans in the group don't overlap, so it's enough to check the latest one starting before finish
+            auto next = lifespans.upper_bound(finish);
+            return next == lifespans.begin() || std::prev(next)->second < start;
+        }
+
+        std::shared_ptr<MemoryBlockWithRelease> block;
+        std::map<int, int> lifespans;  // start -> finish
+    };
+
     void solve() {
-        ov::MemorySolver::normalize_boxes(m_boxes);
-
-        std::vector<std::vector<ov::MemorySolver::Box>> groups;  // groups of non overlapping boxes
-        groups.push_back({m_boxes.front()});
-        for (size_t i = 1; i < m_boxes.size(); ++i) {
-            const auto& box = m_boxes[i];
-            bool groupFound = false;
-            for (auto& group : groups) {
-                const auto& lastBox = group.back();
-                if (lastBox.start > box.finish || lastBox.finish < box.start) {
-                    group.push_back(box);
-                    groupFound = true;
-                    break;
-                }
-            }
+        // Only the boxes inserted after the previous solve are placed. The boxes solved before keep their blocks, as
+        // these blocks may already be bound to the edges, so a repeated insert (e.g. from an inner graph sharing the
+        // memory control) doesn't lead to the full regrouping of the boxes.
+        std::vector<MemorySolver::Box> boxes(std::next(m_boxes.begin(), static_cast<std::ptrdiff_t>(m_solvedBoxes)),
+                                             m_boxes.end());
+        m_solvedBoxes = m_boxes.size();
+
+        auto finishOf = [](const MemorySolver::Box& box) {
+            return box.finish == -1 ? std::numeric_limits<int>::max() : box.finish;
+        };
+        std::sort(boxes.begin(), boxes.end(), [&](const MemorySolver::Box& l, const MemorySolver::Box& r) {
+            return l.start < r.start || (l.start == r.start && finishOf(l) < finishOf(r));
+        });
 
-            if (!groupFound) {
-                groups.push_back({box});
-            }
-        }
-        for (auto& group : groups) {
-            auto unique_block = std::make_shared<MemoryBlockWithRelease>();
-            for (auto& box : group) {
-                m_internalBlocks.insert({box.id, internalBlock(unique_block)});
+        for (const auto& box : boxes) {
+            const int finish = finishOf(box);
+            auto group = std::find_if(m_groups.begin(), m_groups.end(), [&](const Group& candidate) {
+                return candidate.fits(box.start, finish);
+            });
+            if (group == m_groups.end()) {
+                m_groups.push_back({std::make_shared<MemoryBlockWithRelease>(m_growthFactor, m_arena), {}});
+                group = std::prev(m_groups.end());
             }
+            group->lifespans.emplace(box.start, finish);
+            m_internalBlocks.insert({box.id, internalBlock(group->block)});
         }
+        m_solves++;
     }
 
     void allocate() override {
@@ -347,6 +500,25 @@ private:
         for (auto&& item : m_internalBlocks) {
             item.second->free();
         }
+        if (m_arena) {
+            m_arena->release();
+        }
+    }
+    void finishInference() override {
+        if (!m_arena || !m_arena->changed()) {
+            return;
+        }
+        // the blocks have been reallocated, so place them compactly again, the final block sizes are the high-water
+        // mark of the inference
+        size_t highWaterMark = 0;
+        for (auto&& group : m_groups) {
+            highWaterMark += DynamicMemoryArena::alignedSize(group.block->size());
+        }
+        m_arena->reset(highWaterMark);
+        for (auto&& group : m_groups) {
+            group.block->moveToArena();
+        }
+        m_arena->markPlaced();
     }
 
     static const char* getClassName() {
@@ -355,7 +527,12 @@ private:
 
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
+    std::vector<Group> m_groups;
     std::unordered_map<MemoryControl::MemorySolution::key_type, std::shared_ptr<InternalBlock>> m_internalBlocks;
+    DynamicMemoryArenaPtr m_arena;
+    size_t m_solvedBoxes = 0;
+    size_t m_solves = 0;
+    float m_growthFactor;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets& obj);)
 };
@@ -406,7 +583,10 @@ MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerIO& obj) {
             obj.m_blocks.size(),
             total_size,
             total_size,
-            max_region_size};
+            max_region_size,
+            0,  // the blocks are never solved
+            0,  // the blocks are resized by the user
+            0};
 }
 
 MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj) {
@@ -419,7 +599,10 @@ MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj) {
             1,  // in fact there is only one unique block
             obj.m_totalSize,
             static_cast<size_t>(optimal_total_size),
-            static_cast<size_t>(max_region_size)};
+            static_cast<size_t>(max_region_size),
+            obj.m_solves,
+            obj.m_workspace ? obj.m_workspace->reallocations() : 0,
+            0};
 }
 
 MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets& obj) {
@@ -437,6 +620,12 @@ MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets&
                                       [](size_t acc, const auto& item) {
                                           return acc + item->size();
                                       });
+    auto total_reallocations = std::accumulate(uniqueBlocks.begin(),
+                                               uniqueBlocks.end(),
+                                               static_cast<size_t>(0),
+                                               [](size_t acc, const auto& item) {
+                                                   return acc + item->reallocations();
+                                               });
 
     auto [optimal_total_size, max_region_size] = [&obj]() {
         auto tmp_boxes = obj.m_boxes;
@@ -452,7 +641,10 @@ MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets&
             uniqueBlocks.size(),
             total_size,
             static_cast<size_t>(optimal_total_size),
-            static_cast<size_t>(max_region_size)};
+            static_cast<size_t>(max_region_size),
+            obj.m_solves,
+            total_reallocations,
+            0};
 }
 #endif
 
@@ -487,6 +679,10 @@ public:
         m_memManager->release();
     }
 
+    void finishInference() {
+        m_memManager->finishInference();
+    }
+
 #ifdef CPU_DEBUG_CAPS
     [[nodiscard]] MemoryStatisticsRecord dumpStatistics() const {
         return m_statDumper(m_memManager);
@@ -525,7 +721,7 @@ MemoryControl::RegionHandlerPtr buildHandler(F&& f, Args&&... args) {
 
 }  // namespace
 
-MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
+MemoryControl::MemoryControl(std::string id, float growthFactor, size_t arenaLimit) : m_id(std::move(id)) {
     // init handlers
     m_handlers.emplace_back(buildHandler<MemoryManagerStatic>([](const MemoryRegion& reg) {
         return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
@@ -533,10 +729,13 @@ MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
     }));
 
     // handler for static tensors
-    m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>([](const MemoryRegion& reg) {
-        return reg.size < 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>(
+        [](const MemoryRegion& reg) {
+            return reg.size < 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        growthFactor,
+        arenaLimit));
 
     // handler for I/O tensors, so far simply individual blocks
     m_handlers.emplace_back(buildHandler<MemoryManagerIO>([](const MemoryRegion& reg) {
@@ -587,18 +786,26 @@ void MemoryControl::releaseMemory() {
     m_allocated = false;
 }
 
+void MemoryControl::finishInference() {
+    for (auto&& handler : m_handlers) {
+        handler->finishInference();
+    }
+}
+
 #ifdef CPU_DEBUG_CAPS
 MemoryStatistics MemoryControl::dumpStatistics() const {
     MemoryStatistics profileData;
     for (auto&& handler : m_handlers) {
         profileData.push_back(handler->dumpStatistics());
+        profileData.back().total_inferences = m_inferences;
     }
     return profileData;
 }
 #endif  // CPU_DEBUG_CAPS
 
 MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id) {
-    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id))));
+    m_controlUnits.emplace_back(
+        std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id), m_growthFactor, m_arenaLimit)));
     return m_controlUnits.back();
 }
 
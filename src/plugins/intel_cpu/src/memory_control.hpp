@@ -38,6 +38,9 @@ struct MemoryStatisticsRecord {
     size_t total_size;           // bytes
     size_t optimal_total_size;   // bytes
     size_t max_region_size;      // bytes
+    size_t total_solves;         // number of times the regions were (re)solved
+    size_t total_reallocations;  // number of times the already allocated blocks were enlarged
+    size_t total_inferences;     // number of inferences the counters above were collected over
 };
 
 using MemoryStatistics = std::vector<MemoryStatisticsRecord>;
@@ -62,12 +65,25 @@ public:
     void allocateMemory();
     void releaseMemory();
 
+    /**
+     * @brief Notifies the control unit about the start of a new inference, used to collect per inference statistics
+     */
+    void registerInference() {
+        ++m_inferences;
+    }
+
+    /**
+     * @brief Notifies the control unit about the end of the inference, so the memory, which is not used between the
+     * inferences, may be rearranged
+     */
+    void finishInference();
+
     [[nodiscard]] const std::string& getId() const {
         return m_id;
     }
 
 private:
-    explicit MemoryControl(std::string id);
+    MemoryControl(std::string id, float growthFactor, size_t arenaLimit);
     void insert(const MemoryRegion& region, const std::vector<size_t>& syncInds);
     [[nodiscard]] MemoryStatistics dumpStatistics() const;
 
@@ -76,11 +92,20 @@ private:
     std::string m_id;
     std::vector<RegionHandlerPtr> m_handlers;
     bool m_allocated = false;
+    size_t m_inferences = 0;
 };
 
 class NetworkMemoryControl {
 public:
-    NetworkMemoryControl() = default;
+    /**
+     * @param growthFactor is the factor the memory blocks of the dynamic shape tensors are enlarged by at least,
+     * see ov::intel_cpu::cpu_dynamic_memory_growth_factor
+     * @param arenaLimit is the max size of the arena backing the memory blocks of the dynamic shape tensors, zero
+     * disables the arena, see ov::intel_cpu::cpu_dynamic_memory_arena_limit
+     */
+    explicit NetworkMemoryControl(float growthFactor = 1.0F, size_t arenaLimit = 0)
+        : m_growthFactor(growthFactor),
+          m_arenaLimit(arenaLimit) {}
     MemoryControl::Ptr createMemoryControlUnit(std::string id);
 
     void allocateMemory();
@@ -93,6 +118,8 @@ public:
     }
 
 private:
+    float m_growthFactor;
+    size_t m_arenaLimit;
     std::vector<MemoryControl::Ptr> m_controlUnits;
 };
 
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
@@ -38,6 +39,102 @@ using namespace ov::Extensions::Cpu::XARCH;
 
 namespace ov::intel_cpu {
 
+namespace {
+
+// the size of the whole cache buffer including the room reserved for the next tokens
+size_t state_bytes(const VariableStateKVcache::NativeState& state) {
+    const auto precision = state.internal_mem->getDesc().getPrecision();
+    return div_up(state.internal_mem_max_size * precision.bitwidth(), 8);
+}
+
+MemoryPtr copy_memory(const MemoryPtr& mem, size_t bytes) {
+    auto block = std::make_shared<DnnlMemoryBlock>(std::make_unique<MemoryBlockWithReuse>());
+    block->resize(bytes);
+    std::memcpy(block->getRawPtr(), mem->getMemoryBlock()->getRawPtr(), bytes);
+    return std::make_shared<Memory>(mem->getEngine(), mem->getDescPtr(), block);
+}
+
+PlainTensor copy_plain_tensor(const PlainTensor& tensor) {
+    PlainTensor copy;
+    if (tensor) {
+        copy.resize(tensor.shape(), tensor.m_element_size, tensor.m_dt);
+        const size_t bytes = tensor.m_strides[0] * tensor.m_dims[0] * tensor.m_element_size;
+        std::memcpy(copy.m_ptr.get(), tensor.m_ptr.get(), bytes);
+    }
+    return copy;
+}
+
+// the memory is copied as is, so the copy has the same layout and capacity as the original
+VariableStateKVcache::NativeState clone_native_state(const VariableStateKVcache::NativeState& state) {
+    if (!state.internal_mem || !state.hidden_state) {
+        return {};
+    }
+    const auto beam_table_precision = state.hidden_state->getDesc().getPrecision();
+    return {copy_memory(state.internal_mem, state_bytes(state)),
+            copy_memory(state.hidden_state, state.hidden_state_max_size * beam_table_precision.size()),
+            state.internal_mem_max_size,
+            state.hidden_state_max_size,
+            copy_plain_tensor(state.scale_zp)};
+}
+
+// the desc of the first tokens of the KV cache memory, the strides are kept
+MemoryDescPtr truncate_internal_desc(const MemoryPtr& internal_mem, size_t position, const VectorDims& order) {
+    auto internal_desc = internal_mem->getDescWithType<BlockedMemoryDesc>();
+    auto dims = internal_desc->getShape().getStaticDims();
+    OPENVINO_ASSERT(position <= dims[order.at(0)],
+                    "Cannot truncate KV cache state containing ",
+                    dims[order.at(0)],
+                    " tokens to ",
+                    position,
+                    " tokens");
+    dims[order.at(0)] = position;
+    VectorDims blocked_dims(dims.size());
+    for (size_t i = 0; i < dims.size(); i++) {
+        blocked_dims[i] = dims[order[i]];
+    }
+    return std::make_shared<CpuBlockedMemoryDesc>(internal_desc->getPrecision(),
+                                                  Shape(dims),
+                                                  blocked_dims,
+                                                  order,
+                                                  0,
+                                                  VectorDims{},
+                                                  internal_desc->getStrides());
+}
+
+// the desc of the first tokens of the beam table memory, the strides are kept
+MemoryDescPtr truncate_hidden_desc(const MemoryPtr& hidden_state, size_t position) {
+    auto hidden_desc = hidden_state->getDescWithType<BlockedMemoryDesc>();
+    const VectorDims hidden_dims{hidden_desc->getShape().getStaticDims()[0], position};
+    return std::make_shared<CpuBlockedMemoryDesc>(hidden_desc->getPrecision(),
+                                                  Shape(hidden_dims),
+                                                  hidden_dims,
+                                                  VectorDims{0, 1},
+                                                  0,
+                                                  VectorDims{},
+                                                  hidden_desc->getStrides());
+}
+
+// the memory of the first tokens of the state, the memory objects are separate, since the desc is redefined in place
+VariableStateKVcache::NativeState share_native_state(const VariableStateKVcache::NativeState& state,
+                                                     size_t position,
+                                                     const VectorDims& order) {
+    if (!state.internal_mem || !state.hidden_state || position == 0) {
+        return {};
+    }
+    return {std::make_shared<Memory>(state.internal_mem->getEngine(),
+                                     truncate_internal_desc(state.internal_mem, position, order),
+                                     state.internal_mem->getMemoryBlock()),
+            std::make_shared<Memory>(state.hidden_state->getEngine(),
+                                     truncate_hidden_desc(state.hidden_state, position),
+                                     state.hidden_state->getMemoryBlock()),
+            state.internal_mem_max_size,
+            state.hidden_state_max_size,
+            state.scale_zp,
+            true};
+}
+
+}  // namespace
+
 VariableStateBase::VariableStateBase(const std::string& name, MemoryDescPtr external_desc)
     : IVariableState{name},
       m_external_desc{std::move(external_desc)} {}
@@ -227,10 +324,12 @@ void VariableStateSingleBuffer::commit_impl() {
 VariableStateKVcache::VariableStateKVcache(const std::string& name,
                                            MemoryDescPtr external_desc,
                                            BlockedMemoryDescPtr dense_internal_desc,
-                                           ov::Extensions::Cpu::CacheSpec spec)
+                                           ov::Extensions::Cpu::CacheSpec spec,
+                                           bool native_get_state)
     : VariableStateBase(name, std::move(external_desc)),
       m_dense_internal_desc(std::move(dense_internal_desc)),
-      m_spec(spec) {
+      m_spec(spec),
+      m_native_get_state(native_get_state) {
     auto&& shape = get_external_desc()->getShape();
     OPENVINO_ASSERT(shape.isDynamic(), "VariableStateKVcache is unexpectedly initalized with a static tensor");
 }
@@ -246,6 +345,13 @@ ov::SoPtr<ov::ITensor> VariableStateKVcache::get_state() const {
         return std::make_shared<Tensor>(external_mem);
     }
 
+    if (m_native_get_state) {
+        auto state = copy_native_state();
+        auto bytes_desc = std::make_shared<CpuBlockedMemoryDesc>(element::u8, Shape{state_bytes(state)});
+        auto bytes = std::make_shared<Memory>(get_engine(), bytes_desc, state.internal_mem->getMemoryBlock());
+        return std::make_shared<KVCacheNativeTensor>(bytes, std::move(state));
+    }
+
     auto actual_internal_desc = m_internal_mem->getDescWithType<BlockedMemoryDesc>();
     auto&& dims = actual_internal_desc->getShape().getStaticDims();
 
@@ -320,6 +426,14 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
                     "set_state() is not supported for KV cache with TURBO quantization. "
                     "TURBO requires rotation+codebook encoding plus per-token norm metadata "
                     "owned by the SDPA node; external state cannot be injected directly.");
+    if (auto native_tensor = std::dynamic_pointer_cast<KVCacheNativeTensor>(state._ptr)) {
+        // the same tensor may be set to several states, so the memory is shared until the first write
+        const auto& native_state = native_tensor->native_state();
+        const auto position = native_state.internal_mem->getStaticDims()[m_dense_internal_desc->getOrder().at(0)];
+        import_native_state(share_native_state(native_state, position, m_dense_internal_desc->getOrder()));
+        return;
+    }
+
     // 1. reset the memory object
     m_state = state;  // simply to extend the lifetime
     auto state_desc = MemoryDescUtils::generateCpuBlockedMemoryDesc(m_state);
@@ -406,10 +520,158 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
     }
     m_internal_mem_max_size = dense_internal_desc->getCurrentMemSize() / dense_internal_desc->getPrecision().size();
     m_hidden_state_max_size = mem_desc->getCurrentMemSize() / mem_desc->getPrecision().size();
+    m_internal_mem_shared = false;
+    m_hidden_state_shared = false;
+    m_shared_prefix = 0;
+}
+
+VariableStateKVcache::NativeState VariableStateKVcache::copy_native_state() const {
+    return clone_native_state(
+        {m_internal_mem, m_hidden_state, m_internal_mem_max_size, m_hidden_state_max_size, m_scale_zp});
+}
+
+VariableStateKVcache::NativeState VariableStateKVcache::export_native_state(bool detach) {
+    OPENVINO_ASSERT(m_spec.alg != ov::internal::CacheQuantAlgorithm::TURBO,
+                    "Export of KV cache state with TURBO quantization is not supported");
+    if (!m_internal_mem || !m_hidden_state || is_reset_state()) {
+        return {};
+    }
+    if (!detach) {
+        return copy_native_state();
+    }
+
+    NativeState state{std::move(m_internal_mem),
+                      std::move(m_hidden_state),
+                      m_internal_mem_max_size,
+                      m_hidden_state_max_size,
+                      std::move(m_scale_zp),
+                      m_internal_mem_shared || m_hidden_state_shared || m_shared_prefix > 0};
+    // the same as the initial state, so the SDPA node allocates a new cache on the next inference
+    m_internal_mem = nullptr;
+    m_hidden_state = nullptr;
+    m_internal_mem_max_size = 0;
+    m_hidden_state_max_size = 0;
+    m_internal_mem_shared = false;
+    m_hidden_state_shared = false;
+    m_shared_prefix = 0;
+    m_scale_zp = PlainTensor();
+    reset();
+    return state;
+}
+
+void VariableStateKVcache::import_native_state(NativeState state) {
+    OPENVINO_ASSERT(m_spec.alg != ov::internal::CacheQuantAlgorithm::TURBO,
+                    "Import of KV cache state with TURBO quantization is not supported");
+    if (!state.internal_mem || !state.hidden_state) {
+        reset();
+        return;
+    }
+
+    auto internal_desc = state.internal_mem->getDescWithType<BlockedMemoryDesc>();
+    OPENVINO_ASSERT(internal_desc->getPrecision() == m_dense_internal_desc->getPrecision() &&
+                        internal_desc->getOrder() == m_dense_internal_desc->getOrder(),
+                    "KV cache state of variable ",
+                    get_name(),
+                    " has unexpected precision or layout");
+    // the state of another variable may have the same layout, but the kernels read it with the heads and the head
+    // size of this one
+    const auto& dims = internal_desc->getShape().getStaticDims();
+    OPENVINO_ASSERT(m_dense_internal_desc->getShape().isCompatible(dims),
+                    "KV cache state of variable ",
+                    get_name(),
+                    " has unexpected shape ",
+                    internal_desc->getShape().toString());
+    const auto& order = m_dense_internal_desc->getOrder();
+    const size_t size_L = dims[order.at(0)];
+    const size_t size_B = dims[order.at(1)];
+    const size_t size_H = dims[order.at(2)];
+    OPENVINO_ASSERT(state.hidden_state->getShape().getStaticDims() == VectorDims({size_B, size_L}),
+                    "KV cache state of variable ",
+                    get_name(),
+                    " has unexpected beam table shape ",
+                    state.hidden_state->getShape().toString());
+    const bool quantized = any_of(internal_desc->getPrecision(), element::u8, element::u4);
+    OPENVINO_ASSERT(!quantized || static_cast<bool>(state.scale_zp),
+                    "KV cache state of variable ",
+                    get_name(),
+                    " misses the quantization parameters");
+    const auto& scale_zp = state.scale_zp;
+    OPENVINO_ASSERT(!quantized || (scale_zp.m_rank == 4 && scale_zp.size(1) == size_B && scale_zp.size(2) == size_H),
+                    "KV cache state of variable ",
+                    get_name(),
+                    " has unexpected quantization parameters shape");
+
+    m_internal_mem = std::move(state.internal_mem);
+    m_hidden_state = std::move(state.hidden_state);
+    m_internal_mem_max_size = state.internal_mem_max_size;
+    m_hidden_state_max_size = state.hidden_state_max_size;
+    m_scale_zp = std::move(state.scale_zp);
+    m_internal_mem_shared = state.shared;
+    m_hidden_state_shared = state.shared;
+    m_shared_prefix = 0;
+    m_state = {};
+    mark_state_set();
+}
+
+void VariableStateKVcache::fork_from(VariableStateKVcache& source, size_t position) {
+    OPENVINO_ASSERT(m_spec.alg != ov::internal::CacheQuantAlgorithm::TURBO,
+                    "Fork of KV cache state with TURBO quantization is not supported");
+    if (source.is_reset_state() || !source.m_internal_mem || !source.m_hidden_state || position == 0) {
+        reset();
+        return;
+    }
+
+    auto shared = share_native_state({source.m_internal_mem,
+                                      source.m_hidden_state,
+                                      source.m_internal_mem_max_size,
+                                      source.m_hidden_state_max_size,
+                                      source.m_scale_zp},
+                                     position,
+                                     m_dense_internal_desc->getOrder());
+    // the source requantizes its partially filled group of the by-channel quantization in place on append, so a
+    // prefix ending inside a group is copied upfront
+    const bool quantized = any_of(m_dense_internal_desc->getPrecision(), element::u8, element::u4);
+    if (quantized && m_spec.by_channel && position % m_spec.group_size != 0) {
+        import_native_state(clone_native_state(shared));
+        return;
+    }
+
+    import_native_state(std::move(shared));
+    // the beam search reorders the beam table of the source in place, the table is small, so it is copied upfront
+    const auto beam_table_precision = m_hidden_state->getDesc().getPrecision();
+    m_hidden_state = copy_memory(m_hidden_state, m_hidden_state_max_size * beam_table_precision.size());
+    m_hidden_state_shared = false;
+    // the source appends behind the position in place and copies the memory before overwriting the shared tokens
+    source.m_shared_prefix = std::max(source.m_shared_prefix, position);
+}
+
+void VariableStateKVcache::release_shared_prefix(size_t position) {
+    if (position < m_shared_prefix) {
+        // the SDPA node copies the shared memory on the next write, so the forks keep the original one
+        m_internal_mem_shared = true;
+        m_shared_prefix = 0;
+    }
+}
+
+void VariableStateKVcache::trim(size_t position) {
+    if (is_reset_state() || !m_internal_mem || !m_hidden_state) {
+        OPENVINO_ASSERT(position == 0, "Cannot trim empty KV cache state to ", position, " tokens");
+        return;
+    }
+    if (position == 0) {
+        reset();
+        return;
+    }
+    // the tokens behind the position are overwritten by the next inference, their quantization groups (if any) are
+    // requantized on append like the partially filled ones
+    release_shared_prefix(position);
+    m_internal_mem->redefineDesc(truncate_internal_desc(m_internal_mem, position, m_dense_internal_desc->getOrder()));
+    m_hidden_state->redefineDesc(truncate_hidden_desc(m_hidden_state, position));
 }
 
 void VariableStateKVcache::reset_impl() {
-    // nothing to do
+    // the SDPA node writes a reset cache from the first token in place
+    release_shared_prefix(0);
 }
 
 void VariableStateKVcache::commit_impl() {
@@ -433,7 +695,11 @@ MemoryPtr VariableStateKVcache::internal_state_mem() const {
 }
 
 void VariableStateKVcache::assign_internal_state(const MemoryPtr& mem) {
+    if (mem != m_internal_mem) {
+        m_shared_prefix = 0;
+    }
     m_internal_mem = mem;
+    m_internal_mem_shared = false;
 }
 
 MemoryPtr VariableStateKVcache::hidden_state_mem() const {
@@ -442,5 +708,6 @@ MemoryPtr VariableStateKVcache::hidden_state_mem() const {
 
 void VariableStateKVcache::assign_hidden_state(const MemoryPtr& mem) {
     m_hidden_state = mem;
+    m_hidden_state_shared = false;
 }
 }  // namespace ov::intel_cpu
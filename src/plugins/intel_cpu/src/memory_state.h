@@ -9,8 +9,10 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <utility>
 
 #include "cpu_memory.h"
+#include "cpu_tensor.h"
 #include "memory_desc/blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "nodes/kernels/scaled_attn/cache_spec.hpp"
@@ -57,6 +59,11 @@ protected:
         return m_external_desc;
     }
 
+    // for the states assigned bypassing set_state()
+    void mark_state_set() {
+        reset_state_flag = false;
+    }
+
 private:
     MemoryDescPtr m_external_desc;
     bool reset_state_flag = true;
@@ -121,10 +128,23 @@ private:
 
 class VariableStateKVcache : public VariableStateBase {
 public:
+    // The state in the layout of the SDPA node: the (possibly quantized) cache including the room reserved for the next
+    // tokens, the beam table and the quantization parameters. It is meaningful only within the process.
+    struct NativeState {
+        MemoryPtr internal_mem;
+        MemoryPtr hidden_state;
+        size_t internal_mem_max_size = 0;
+        size_t hidden_state_max_size = 0;
+        PlainTensor scale_zp;
+        // the memory is shared with other states
+        bool shared = false;
+    };
+
     VariableStateKVcache(const std::string& name,
                          MemoryDescPtr external_desc,
                          BlockedMemoryDescPtr dense_internal_desc,
-                         ov::Extensions::Cpu::CacheSpec spec);
+                         ov::Extensions::Cpu::CacheSpec spec,
+                         bool native_get_state = false);
 
     // ov::IVariableState
     ov::SoPtr<ov::ITensor> get_state() const override;
@@ -140,16 +160,16 @@ public:
     MemoryPtr hidden_state_mem() const;
     void assign_hidden_state(const MemoryPtr& mem);
 
-    // size in elements count
+    // size in elements count, zero for the shared memory, so the SDPA node copies it before the first write
     size_t internal_state_max_size() const {
-        return m_internal_mem_max_size;
+        return m_internal_mem_shared ? 0 : m_internal_mem_max_size;
     }
     void assign_internal_state_max_size(size_t max_size) {
         m_internal_mem_max_size = max_size;
     }
 
     size_t hidden_state_max_size() const {
-        return m_hidden_state_max_size;
+        return m_hidden_state_shared ? 0 : m_hidden_state_max_size;
     }
     void assign_hidden_state_max_size(size_t max_size) {
         m_hidden_state_max_size = max_size;
@@ -166,16 +186,36 @@ public:
         return m_spec;
     }
 
+    // With detach the memory is handed over and the state is reset, otherwise the memory is copied as is
+    NativeState export_native_state(bool detach);
+    // Takes the ownership of the state exported from a state of the same variable
+    void import_native_state(NativeState state);
+    // Shares the first tokens of the source state of the same variable, this state copies them on the first write
+    // (copy-on-write). The source keeps the memory and appends to it, it copies the memory only if it is about to
+    // overwrite the shared tokens. The source state must not be used concurrently.
+    void fork_from(VariableStateKVcache& source, size_t position);
+    // Drops the tokens behind the position in place, e.g. the draft tokens rejected by speculative decoding. Neither
+    // the cache nor the beam table is copied, the reserved room stays for the next tokens.
+    void trim(size_t position);
+
 private:
     // ov::intel_cpu::VariableStateBase
     void set_state_impl(const ov::SoPtr<ov::ITensor>& state) override;
     void reset_impl() override;
     void commit_impl() override;
 
+    NativeState copy_native_state() const;
+    // the tokens behind the position are about to be overwritten in place
+    void release_shared_prefix(size_t position);
+
     MemoryPtr m_internal_mem;  // kv cache
     MemoryPtr m_hidden_state;  // beam access table
     size_t m_internal_mem_max_size = 0;
     size_t m_hidden_state_max_size = 0;
+    bool m_internal_mem_shared = false;
+    bool m_hidden_state_shared = false;
+    // number of the first tokens of the memory shared with the forks of this state
+    size_t m_shared_prefix = 0;
 
     // this desc stores the internal prc and axis permutation
     BlockedMemoryDescPtr m_dense_internal_desc;
@@ -183,6 +223,26 @@ private:
     // for u8 kv cache: [B, H, L, 2], 0 for scale, 1 for zp
     PlainTensor m_scale_zp;
     ov::Extensions::Cpu::CacheSpec m_spec;
+
+    // get_state() returns the state in the native layout instead of the external one
+    bool m_native_get_state = false;
+};
+
+// Opaque tensor holding the bytes of the KV cache in the native layout, which is returned by get_state() when
+// the native layout is requested. set_state() of a state of the same variable shares its memory without any
+// conversion, the state copies it on the first write.
+class KVCacheNativeTensor : public Tensor {
+public:
+    KVCacheNativeTensor(MemoryPtr bytes, VariableStateKVcache::NativeState state)
+        : Tensor(std::move(bytes)),
+          m_state(std::move(state)) {}
+
+    const VariableStateKVcache::NativeState& native_state() const {
+        return m_state;
+    }
+
+private:
+    VariableStateKVcache::NativeState m_state;
 };
 
 using MemStatePtr = std::shared_ptr<IVariableState>;
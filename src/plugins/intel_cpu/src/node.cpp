@@ -1131,8 +1131,9 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
     auto weightCache = context->getWeightsCache();
     if (weightCache != nullptr && memory::format_kind::blocked == intDesc->getDnnlDesc().get_format_kind()) {
         const auto string_hash = name + "_" + std::to_string(indx) + "_" +
-                                 DnnlExtensionUtils::computeWeightsStringHash(internalBlob, intDesc);
-        ptr = static_cast<MemoryPtr>(*weightCache->findOrCreate(string_hash, create));
+                                 DnnlExtensionUtils::computeWeightsStringHash(weightCache->weightsKey(internalBlob),
+                                                                              intDesc);
+        ptr = static_cast<MemoryPtr>(*weightCache->findOrCreateShared(string_hash, create));
     } else {
         ptr = create();
     }
@@ -1177,8 +1178,9 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
 
     auto weightCache = context->getWeightsCache();
     if (weightCache != nullptr) {
-        const auto string_hash = DnnlExtensionUtils::computeWeightsStringHash(edgeMem, dstWeightDesc);
-        ptr = static_cast<MemoryPtr>(*weightCache->findOrCreate(string_hash, create));
+        const auto string_hash =
+            DnnlExtensionUtils::computeWeightsStringHash(weightCache->weightsKey(edgeMem), dstWeightDesc);
+        ptr = static_cast<MemoryPtr>(*weightCache->findOrCreateShared(string_hash, create));
     } else {
         ptr = create();
     }
@@ -1203,7 +1205,8 @@ void Node::toNumaNodeImpl(int numaNodeID) {
 
     // create scratch pad from specified numa node
     if (scratchpadMem) {
-        scratchpadMem = context->getScratchPad()->createScratchPadMem(scratchpadMem->getDescPtr());
+        scratchpadMem =
+            context->getScratchPad(numaNodeID, scratchPadLane)->createScratchPadMem(scratchpadMem->getDescPtr());
         primArgs[DNNL_ARG_SCRATCHPAD] = scratchpadMem->getPrimitive();
     }
 
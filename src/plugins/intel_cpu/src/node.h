@@ -828,6 +828,7 @@ protected:
 
     MemoryPtr getScratchPadMem(const MemoryDescPtr& desc) {
         if (!scratchpadMem || !scratchpadMem->getDesc().isCompatible(*desc)) {
+            scratchPadLane = GraphContext::getScratchPadLane();
             scratchpadMem = context->getScratchPad()->createScratchPadMem(desc);
         }
         return scratchpadMem;
@@ -877,6 +878,8 @@ private:
     PerfCounters profiling;
 
     MemoryPtr scratchpadMem;
+    // the lane of the scratch pad the memory is taken from (inter-op parallelism)
+    size_t scratchPadLane = 0;
 
     // Hold output scales
     std::vector<float> DQScales;
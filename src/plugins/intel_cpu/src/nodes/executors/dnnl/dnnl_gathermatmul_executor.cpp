@@ -7,6 +7,7 @@
 #include <oneapi/dnnl/dnnl_common_types.h>
 #include <oneapi/dnnl/dnnl_types.h>
 
+#include <algorithm>
 #include <common/primitive_hashing_utils.hpp>
 #include <common/utils.hpp>
 #include <cstddef>
@@ -20,7 +21,6 @@
 #include <utility>
 #include <vector>
 
-#include "nodes/common/blocked_desc_creator.h"
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
 #    include <cpu/x64/cpu_isa_traits.hpp>
 #endif
@@ -28,6 +28,7 @@
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
 #include "memory_desc/blocked_memory_desc.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 #include "memory_desc/dnnl_memory_desc.h"
@@ -239,6 +240,9 @@ Dim normalizeM(Dim M) {
     return M;
 }
 
+// upper bound of the rows of the temporary buffer, unless a single expert needs more
+constexpr Dim groupedGemmRowsPerPass = 1024;
+
 // ---- GatherMatmulDnnlExecutor -----------------------------------------------
 
 dnnl::memory::desc makeBiasMd(dnnl::memory::dim N, const MemoryPtr& biasMem) {
@@ -276,10 +280,11 @@ bool GatherMatmulDnnlExecutor::supports([[maybe_unused]] const GatherMatmulConfi
 #endif
 }
 
-GatherMatmulDnnlExecutor::GatherMatmulDnnlExecutor([[maybe_unused]] const GatherMatmulAttrs& attrs,
+GatherMatmulDnnlExecutor::GatherMatmulDnnlExecutor(const GatherMatmulAttrs& attrs,
                                                    const MemoryArgs& memory,
                                                    const ExecutorContext::CPtr& context)
-    : m_context(context) {
+    : m_context(context),
+      m_groupedGemmMinTokens(attrs.groupedGemmMinTokens) {
     const auto& weightsMemory = memory.at(ARG_WEI);
     const auto& srcMemory = memory.at(ARG_SRC);
 
@@ -320,14 +325,17 @@ GatherMatmulDnnlExecutor::GatherMatmulDnnlExecutor([[maybe_unused]] const Gather
         }
     }
 
-    dnnl::memory::desc src_md({1, K},
-                              DnnlExtensionUtils::ElementTypeToDataType(src_precision),
-                              dnnl::memory::format_tag::ab);
+    m_srcMd = dnnl::memory::desc({1, K},
+                                 DnnlExtensionUtils::ElementTypeToDataType(src_precision),
+                                 dnnl::memory::format_tag::ab);
     dnnl::memory::desc weights_md({N, K},
                                   DnnlExtensionUtils::ElementTypeToDataType(weights_precision),
                                   dnnl::memory::format_tag::any);
+    m_biasMd = makeBiasMd(N, memory.at(ARG_BIAS));
+    m_scaleShape = scale_shape;
+    m_zpShape = zp_shape;
 
-    InnerProductKey key{src_md, weights_md, makeBiasMd(N, memory.at(ARG_BIAS)), scale_shape, zp_shape};
+    InnerProductKey key{m_srcMd, weights_md, m_biasMd, scale_shape, zp_shape};
 
     const auto& eng = context->getEngine();
     const auto threadPool = context->getThreadPool();
@@ -398,73 +406,54 @@ GatherMatmulDnnlExecutor::GatherMatmulDnnlExecutor([[maybe_unused]] const Gather
     }
 
     m_implType = m_gemvImpl->get_impl_type();
-}
 
-bool GatherMatmulDnnlExecutor::update(const MemoryArgs& memory) {
-    if (!m_bf16AmxMode) {
-        return true;
+    // AMX GEMM pays off from a single tile of rows, it's padded anyway
+    if (m_bf16AmxMode && m_groupedGemmMinTokens > 0) {
+        m_groupedGemmMinTokens = 1;
     }
+    // the weights are packed for GEMV, the grouping isn't worth it if there is no optimized GEMM for such a layout
+    if (m_groupedGemmMinTokens > 0) {
+        const auto gemmImplType = getGemmImpl(normalizeM(m_groupedGemmMinTokens))->get_impl_type();
+        if ((gemmImplType & impl_desc_type::ref) == impl_desc_type::ref) {
+            m_groupedGemmMinTokens = 0;
+        }
+    }
+}
 
-    const auto& srcMem = memory.at(ARG_SRC);
-    const auto& srcShape = srcMem->getStaticDims();
-    // srcShape is [B, M, K]
-    if (Dim{1} == srcShape[1]) {
-        // If M is 1, we can skip the temporary buffer and execute GEMV in-place on the src buffer
+bool GatherMatmulDnnlExecutor::update(const MemoryArgs& memory) {
+    // the GEMM implementations depend on the routing, so they are prepared by execute(), while the temporary buffer is
+    // sized for the largest pass: the rows of a pass are bounded by groupedGemmRowsPerPass, unless a single expert
+    // needs more, and an expert is grouped for at most M tokens
+    const auto M = memory.at(ARG_SRC_1)->getStaticDims()[0];
+    if (m_groupedGemmMinTokens == 0 || M < std::max<size_t>(m_groupedGemmMinTokens, 2)) {
         return true;
     }
-    const Dim M = normalizeM(srcShape[1]);
-    const auto& creatorsMap = BlockedDescCreator::getCommonCreators();
-    const auto srcPrc = srcMem->getDesc().getPrecision();
-
-    const auto& dstMem = memory.at(ARG_DST);
-    const auto& dstShape = dstMem->getStaticDims();
-
-    m_tmpInputDesc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(srcPrc, Shape({M, srcShape[2]}));
-    m_tmpOutputDesc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(srcPrc, Shape({M, dstShape[2]}));
-
-    const size_t srcSize = rnd_up(m_tmpInputDesc->getCurrentMemSize(), 64);
-    const size_t totalSize = srcSize + m_tmpOutputDesc->getCurrentMemSize();
-    auto scratchPadDesc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(ov::element::u8, Shape({totalSize}));
-    m_tmpInpBuffer = m_context->getScratchPad()->createScratchPadMem(scratchPadDesc);
-
-    OPENVINO_ASSERT(m_gemvImpl, "GEMV implementation is not created");
-
-    dnnl::memory::desc src_md({static_cast<dnnl::memory::dim>(M), static_cast<dnnl::memory::dim>(srcShape[2])},
-                              DnnlExtensionUtils::ElementTypeToDataType(srcPrc),
-                              dnnl::memory::format_tag::ab);
-    auto weights_md = m_gemvImpl->get_weights_md();
+    const auto element_size = memory.at(ARG_SRC)->getDesc().getPrecision().size();
+    const auto K_size = memory.at(ARG_SRC)->getStaticDims()[2];
+    const auto N_size = memory.at(ARG_DST)->getStaticDims()[2];
+    const size_t rows = std::max(groupedGemmRowsPerPass, normalizeM(M));
+    const size_t input_size = rnd_up(rows * K_size * element_size, 64);
+    const size_t total_size = input_size + rows * N_size * element_size;
+    auto scratchPadDesc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::u8, Shape{total_size});
+    m_tmpBuffer = m_context->getScratchPad()->createScratchPadMem(scratchPadDesc);
+    return true;
+}
 
-    VectorDims scale_shape{};
-    VectorDims zp_shape{};
-    if (m_scalesMemory) {
-        const auto& fullScaleDims = m_scalesMemory->getStaticDims();
-        if (1 == fullScaleDims.size()) {
-            scale_shape.push_back(fullScaleDims[0]);
-        } else {
-            scale_shape.assign(fullScaleDims.begin() + 1, fullScaleDims.end());
-        }
-    }
-    if (m_zpMemory) {
-        const auto& fullZpDims = m_zpMemory->getStaticDims();
-        if (1 == fullZpDims.size()) {
-            zp_shape.push_back(fullZpDims[0]);
-        } else {
-            zp_shape.assign(fullZpDims.begin() + 1, fullZpDims.end());
-        }
+GatherMatmulDnnlExecutor::InnerProductPtr GatherMatmulDnnlExecutor::getGemmImpl(Dim M) {
+    auto& gemmImpl = m_gemmImpls[M];
+    if (!gemmImpl) {
+        dnnl::memory::desc src_md({static_cast<dnnl::memory::dim>(M), m_srcMd.get_dims()[1]},
+                                  m_srcMd.get_data_type(),
+                                  dnnl::memory::format_tag::ab);
+        InnerProductKey key{src_md, m_gemvImpl->get_weights_md(), m_biasMd, m_scaleShape, m_zpShape};
+        const auto& eng = m_context->getEngine();
+        const auto threadPool = m_context->getThreadPool();
+        std::tie(gemmImpl, std::ignore) =
+            m_context->getRuntimeCache()->getOrCreate(key, [&eng, &threadPool](const InnerProductKey& k) {
+                return std::make_shared<InnerProduct>(eng, threadPool, k);
+            });
     }
-
-    InnerProductKey key{src_md,
-                        weights_md,
-                        makeBiasMd(static_cast<dnnl::memory::dim>(weights_md.get_dims()[0]), memory.at(ARG_BIAS)),
-                        scale_shape,
-                        zp_shape};
-    const auto& eng = m_context->getEngine();
-    const auto threadPool = m_context->getThreadPool();
-    auto cache = m_context->getRuntimeCache();
-    std::tie(m_gemmImpl, std::ignore) = cache->getOrCreate(key, [&eng, &threadPool](const InnerProductKey& k) {
-        return std::make_shared<InnerProduct>(eng, threadPool, k);
-    });
-    return true;
+    return gemmImpl;
 }
 
 void GatherMatmulDnnlExecutor::execute(const MemoryArgs& memory) {
@@ -506,77 +495,113 @@ void GatherMatmulDnnlExecutor::execute(const MemoryArgs& memory) {
             }
         }
 
-        if (m_bf16AmxMode) {
-            OPENVINO_ASSERT(m_tmpInpBuffer, "Temporary input/output memory is not created");
-            OPENVINO_ASSERT(m_tmpInputDesc, "Temporary input memory desc is not created");
-            OPENVINO_ASSERT(m_tmpOutputDesc, "Temporary output memory desc is not created");
+        // the experts with enough tokens are executed as one GEMM per expert, the rest token by token
+        auto is_grouped = [&](size_t gather_axis_index) {
+            const auto tokens = static_cast<size_t>(elements_per_gather_indx[gather_axis_index]);
+            // a token routed twice to the same expert doesn't fit the rows prepared by update()
+            return m_groupedGemmMinTokens > 0 && tokens >= m_groupedGemmMinTokens && tokens <= M;
+        };
+        std::vector<size_t> grouped_experts;
+        for (size_t gather_axis_index = 0; gather_axis_index < gather_axis_size; gather_axis_index++) {
+            if (is_grouped(gather_axis_index)) {
+                grouped_experts.push_back(gather_axis_index);
+            }
+        }
 
-            const auto element_size = m_tmpInputDesc->getPrecision().size();
-            const auto K_size = m_tmpInputDesc->getShape().getStaticDims()[1];
-            const auto M_size = m_tmpInputDesc->getShape().getStaticDims()[0];
+        if (!grouped_experts.empty()) {
+            const auto element_size = srcMem->getDesc().getPrecision().size();
+            const auto K_size = srcMem->getStaticDims()[2];
             const auto N_size = dstMem->getStaticDims()[2];
 
-            auto* input_ptr = m_tmpInpBuffer->getDataAs<uint8_t>();
-            auto* output_ptr = input_ptr + rnd_up(m_tmpInputDesc->getCurrentMemSize(), 64);
-
-            Memory tmpInput(m_context->getEngine(), m_tmpInputDesc, input_ptr);
-            Memory tmpOutput(m_context->getEngine(), m_tmpOutputDesc, output_ptr);
-
-            auto tmp_input_offset = OffsetHelper::createOffsetHelper(tmpInput);
-            auto tmp_dst_offset = OffsetHelper::createOffsetHelper(tmpOutput);
+            // the tokens of several experts are gathered into the rows of the temporary buffer at once, each expert
+            // padded to the normalized number of rows, so the gathering and the scattering are parallel over the
+            // tokens of all these experts
+            std::vector<size_t> row_offsets;
+            std::vector<int32_t> row_sources;
+            for (size_t first = 0; first < grouped_experts.size();) {
+                size_t rows = 0;
+                size_t last = first;
+                row_offsets.clear();
+                for (; last < grouped_experts.size(); last++) {
+                    const auto padded_rows =
+                        normalizeM(static_cast<Dim>(elements_per_gather_indx[grouped_experts[last]]));
+                    if (last > first && rows + padded_rows > groupedGemmRowsPerPass) {
+                        break;
+                    }
+                    row_offsets.push_back(rows);
+                    rows += padded_rows;
+                }
 
-            OPENVINO_ASSERT(m_gemmImpl, "GEMM implementation is not created");
-            for (size_t gather_axis_index = 0; gather_axis_index < gather_axis_size; gather_axis_index++) {
-                const size_t num_valid_rows = elements_per_gather_indx[gather_axis_index];
-                if (0 == num_valid_rows) {
-                    continue;
+                const size_t input_size = rnd_up(rows * K_size * element_size, 64);
+                OPENVINO_ASSERT(m_tmpBuffer && m_tmpBuffer->getSize() >= input_size + rows * N_size * element_size,
+                                "The temporary buffer of the grouped GEMM is not prepared for ",
+                                rows,
+                                " rows");
+                auto* input_ptr = m_tmpBuffer->getDataAs<uint8_t>();
+                auto* output_ptr = input_ptr + input_size;
+
+                // index in gather_idx_map of the token of each row, -1 for the padding
+                row_sources.assign(rows, -1);
+                for (size_t i = first; i < last; i++) {
+                    const auto gather_axis_index = grouped_experts[i];
+                    for (int32_t m = 0; m < elements_per_gather_indx[gather_axis_index]; m++) {
+                        row_sources[row_offsets[i - first] + m] = static_cast<int32_t>(gather_axis_index * M + m);
+                    }
                 }
 
-                cpu_parallel->parallel_for(M_size, [&](size_t m) {
-                    auto* dst_row = tmp_input_offset(m);
-                    if (m < num_valid_rows) {
-                        const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
-                        const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
-                        const auto* src_data = src_offset(batch_index, row_id);
-                        std::memcpy(dst_row, src_data, K_size * element_size);
-                    } else {
+                cpu_parallel->parallel_for(rows, [&](size_t row) {
+                    auto* dst_row = input_ptr + row * K_size * element_size;
+                    if (row_sources[row] < 0) {
                         std::memset(dst_row, 0, K_size * element_size);
+                        return;
                     }
+                    const auto [row_id, batch_index] = gather_idx_map[row_sources[row]];
+                    std::memcpy(dst_row, src_offset(batch_index, row_id), K_size * element_size);
                 });
 
-                auto* src = tmp_input_offset.get_base();
-                auto* dst = tmp_dst_offset.get_base();
-                auto* wei = wei_offset(gather_axis_index);
-                auto* bias = bias_offset(gather_axis_index);
-                auto* scale = scale_offset(gather_axis_index);
-                auto* zp = zp_offset(gather_axis_index);
-                m_gemmImpl->exec(src, dst, wei, bias, scale, zp);
-
-                cpu_parallel->parallel_for(num_valid_rows, [&](size_t m) {
-                    const auto* src_row = tmp_dst_offset(m);
-                    const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
-                    const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
-                    auto* dst_row = dst_offset(batch_index, row_id);
-                    std::memcpy(dst_row, src_row, N_size * element_size);
+                // the weights of an expert are read (and decompressed) once for all its tokens
+                for (size_t i = first; i < last; i++) {
+                    const auto gather_axis_index = grouped_experts[i];
+                    const auto row_offset = row_offsets[i - first];
+                    auto gemmImpl =
+                        getGemmImpl(normalizeM(static_cast<Dim>(elements_per_gather_indx[gather_axis_index])));
+                    gemmImpl->exec(input_ptr + row_offset * K_size * element_size,
+                                   output_ptr + row_offset * N_size * element_size,
+                                   wei_offset(gather_axis_index),
+                                   bias_offset(gather_axis_index),
+                                   scale_offset(gather_axis_index),
+                                   zp_offset(gather_axis_index));
+                }
+
+                cpu_parallel->parallel_for(rows, [&](size_t row) {
+                    if (row_sources[row] < 0) {
+                        return;
+                    }
+                    const auto [row_id, batch_index] = gather_idx_map[row_sources[row]];
+                    std::memcpy(dst_offset(batch_index, row_id),
+                                output_ptr + row * N_size * element_size,
+                                N_size * element_size);
                 });
+
+                first = last;
             }
-        } else {
-            OPENVINO_ASSERT(m_gemvImpl, "GEMV implementation is not created");
-            for (size_t gather_axis_index = 0; gather_axis_index < gather_axis_size; gather_axis_index++) {
-                if (0 == elements_per_gather_indx[gather_axis_index]) {
-                    continue;
-                }
-                auto* wei = wei_offset(gather_axis_index);
-                auto* bias = bias_offset(gather_axis_index);
-                auto* scale = scale_offset(gather_axis_index);
-                auto* zp = zp_offset(gather_axis_index);
-                for (int32_t m = 0; m < elements_per_gather_indx[gather_axis_index]; ++m) {
-                    const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
-                    const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
-                    auto* src = src_offset(batch_index, row_id);
-                    auto* dst = dst_offset(batch_index, row_id);
-                    m_gemvImpl->exec(src, dst, wei, bias, scale, zp);
-                }
+        }
+
+        OPENVINO_ASSERT(m_gemvImpl, "GEMV implementation is not created");
+        for (size_t gather_axis_index = 0; gather_axis_index < gather_axis_size; gather_axis_index++) {
+            if (0 == elements_per_gather_indx[gather_axis_index] || is_grouped(gather_axis_index)) {
+                continue;
+            }
+            auto* wei = wei_offset(gather_axis_index);
+            auto* bias = bias_offset(gather_axis_index);
+            auto* scale = scale_offset(gather_axis_index);
+            auto* zp = zp_offset(gather_axis_index);
+            for (int32_t m = 0; m < elements_per_gather_indx[gather_axis_index]; ++m) {
+                const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
+                const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
+                auto* src = src_offset(batch_index, row_id);
+                auto* dst = dst_offset(batch_index, row_id);
+                m_gemvImpl->exec(src, dst, wei, bias, scale, zp);
             }
         }
     } else {
@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
+#include <unordered_map>
 
 #include "cpu_memory.h"
-#include "memory_desc/cpu_memory_desc.h"
+#include "cpu_types.h"
 #include "nodes/executors/executor.hpp"
 #include "nodes/executors/gathermatmul_config.hpp"
 #include "nodes/executors/memory_arguments.hpp"
@@ -32,19 +34,26 @@ private:
     class InnerProduct;
     using InnerProductPtr = std::shared_ptr<InnerProduct>;
 
+    InnerProductPtr getGemmImpl(Dim M);
+
     ExecutorContext::CPtr m_context;
 
     MemoryPtr m_weightsMemory;
     MemoryPtr m_scalesMemory;
     MemoryPtr m_zpMemory;
 
+    dnnl::memory::desc m_srcMd;
+    dnnl::memory::desc m_biasMd;
+    VectorDims m_scaleShape;
+    VectorDims m_zpShape;
+
     InnerProductPtr m_gemvImpl;
-    InnerProductPtr m_gemmImpl;
+    // GEMM implementations by the padded number of rows
+    std::unordered_map<Dim, InnerProductPtr> m_gemmImpls;
 
-    MemoryPtr m_tmpInpBuffer;
-    MemoryDescPtr m_tmpInputDesc;
-    MemoryDescPtr m_tmpOutputDesc;
+    MemoryPtr m_tmpBuffer;
 
+    size_t m_groupedGemmMinTokens = 0;
     bool m_bf16AmxMode = false;
     impl_desc_type m_implType = impl_desc_type::unknown;
 };
@@ -105,9 +105,9 @@ MemoryPtr prepareWeightsMemory(const DnnlMemoryDescPtr& srcWeightDesc,
 
     MemoryPtr ptr;
     if (globalWeightCache && dnnl::memory::format_kind::blocked == dstWeightDesc->getDnnlDesc().get_format_kind()) {
-        ptr = MemoryPtr(
-            *globalWeightCache->findOrCreate(DnnlExtensionUtils::computeWeightsStringHash(weightsMem, dstWeightDesc),
-                                             create));
+        const auto string_hash =
+            DnnlExtensionUtils::computeWeightsStringHash(globalWeightCache->weightsKey(weightsMem), dstWeightDesc);
+        ptr = MemoryPtr(*globalWeightCache->findOrCreateShared(string_hash, create));
     } else {
         ptr = create();
     }
@@ -72,8 +72,9 @@ public:
         return runtimeCachePtr;
     }
 
+    // the executors are created before the scratch pad lanes of the nodes are selected, so the lane is taken on call
     [[nodiscard]] DnnlScratchPadPtr getScratchPad() const {
-        return scratchPads[curNumaNodeId];
+        return scratchPads[GraphContext::getScratchPadLane()][curNumaNodeId];
     }
 
     [[nodiscard]] std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> getPrivateWeightCache() const {
@@ -104,7 +105,7 @@ private:
     // weak_ptr is required to avoid cycle dependencies with MultiCache
     // since ExecutorContext is stored in Executor itself
     MultiCacheWeakPtr runtimeCache;
-    std::vector<DnnlScratchPadPtr> scratchPads;
+    std::vector<std::vector<DnnlScratchPadPtr>> scratchPads;
     WeightsSharing::Ptr weightsCache;
     const dnnl::engine& engine;
     std::vector<impl_desc_type> implPriorities;
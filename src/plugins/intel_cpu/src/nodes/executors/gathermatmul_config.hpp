@@ -4,11 +4,16 @@
 
 #pragma once
 
+#include <cstddef>
+
 #include "executor_config.hpp"
 
 namespace ov::intel_cpu {
 
-struct GatherMatmulAttrs {};
+struct GatherMatmulAttrs {
+    // minimal number of the tokens of an expert executed as one GEMM, 0 disables the grouping
+    size_t groupedGemmMinTokens = 0;
+};
 
 using GatherMatmulConfig = executor::Config<GatherMatmulAttrs>;
 
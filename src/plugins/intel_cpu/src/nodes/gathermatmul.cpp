@@ -202,6 +202,8 @@ GatherMatmul::GatherMatmul(const std::shared_ptr<ov::Node>& op, const GraphConte
         m_atoi[ARG_SRC_3] = WEIGHT_SCALES;
         m_atoi[ARG_SRC_4] = WEIGHT_ZERO_POINTS;
     }
+
+    m_attrs.groupedGemmMinTokens = context->getConfig().moeGroupedGemmMinTokens;
 }
 
 void GatherMatmul::initSupportedPrimitiveDescriptors() {
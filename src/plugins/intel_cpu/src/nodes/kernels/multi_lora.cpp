@@ -0,0 +1,211 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "multi_lora.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "cpu_parallel.hpp"
+#include "dnnl_extension_utils.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/type/bfloat16.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/core/type/float16.hpp"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+// (x * A^T) * alpha in the precision of the LoRA matrices, the same as the LoRA subgraph rounds it
+template <typename T>
+void scale_low_rank(const float* low_rank,
+                    const T* alpha,
+                    T* dst,
+                    size_t M,
+                    size_t rank,
+                    const CpuParallelPtr& cpu_parallel) {
+    cpu_parallel->parallel_for(M, [&](size_t m) {
+        for (size_t j = 0; j < rank; j++) {
+            dst[m * rank + j] = static_cast<T>(low_rank[m * rank + j] * static_cast<float>(alpha[j]));
+        }
+    });
+}
+
+}  // namespace
+
+MultiLoRA::MultiLoRA(dnnl::engine engine, ov::element::Type precision)
+    : m_engine(std::move(engine)),
+      m_precision(precision) {
+    OPENVINO_ASSERT(any_of(m_precision, ov::element::f32, ov::element::bf16, ov::element::f16),
+                    "Multi-adapter LoRA doesn't support precision ",
+                    m_precision);
+}
+
+const dnnl::matmul& MultiLoRA::getMatMul(size_t K, size_t N, size_t ldb, bool accumulate) {
+    auto& matmul = m_matmuls[std::make_tuple(K, N, ldb, accumulate)];
+    if (!matmul) {
+        using dims = dnnl::memory::dims;
+        const auto dataType = DnnlExtensionUtils::ElementTypeToDataType(m_precision);
+        const auto k = static_cast<dnnl::memory::dim>(K);
+        const auto n = static_cast<dnnl::memory::dim>(N);
+        const dnnl::memory::desc src_md(dims{DNNL_RUNTIME_DIM_VAL, k}, dataType, dims{k, 1});
+        const dnnl::memory::desc weights_md(dims{k, n}, dataType, dims{1, static_cast<dnnl::memory::dim>(ldb)});
+        // the low-rank product is kept in f32 until it's scaled by alpha
+        const dnnl::memory::desc dst_md(dims{DNNL_RUNTIME_DIM_VAL, n},
+                                        accumulate ? dataType : dnnl::memory::data_type::f32,
+                                        dims{n, 1});
+        dnnl::primitive_attr attr;
+        if (accumulate) {
+            dnnl::post_ops ops;
+            ops.append_sum(1.F);
+            attr.set_post_ops(ops);
+        }
+        matmul = dnnl::matmul(dnnl::matmul::primitive_desc(m_engine, src_md, weights_md, dst_md, attr));
+    }
+    return matmul;
+}
+
+void MultiLoRA::execute(const dnnl::stream& strm,
+                        const void* main,
+                        const void* x,
+                        const void* a,
+                        const void* alpha,
+                        const void* b,
+                        void* dst,
+                        size_t rows,
+                        size_t K,
+                        size_t N,
+                        size_t rank,
+                        const std::vector<size_t>& rank_offsets,
+                        const std::vector<int32_t>& adapter_ids,
+                        const CpuParallelPtr& cpu_parallel) {
+    const size_t elem = m_precision.size();
+    const auto* main_ptr = static_cast<const uint8_t*>(main);
+    const auto* x_ptr = static_cast<const uint8_t*>(x);
+    auto* dst_ptr = static_cast<uint8_t*>(dst);
+
+    // batch elements of each adapter, the rest only pass the main flow through
+    std::vector<std::vector<size_t>> buckets(rank_offsets.size() - 1);
+    std::vector<size_t> passed;
+    size_t max_rows = 0;
+    size_t max_rank = 0;
+    for (size_t i = 0; i < adapter_ids.size(); i++) {
+        const auto id = adapter_ids[i];
+        if (id < 0 || rank_offsets[id + 1] == rank_offsets[id]) {
+            passed.push_back(i);
+            continue;
+        }
+        buckets[id].push_back(i);
+        max_rows = std::max(max_rows, buckets[id].size() * rows);
+        max_rank = std::max(max_rank, rank_offsets[id + 1] - rank_offsets[id]);
+    }
+
+    if (main != dst) {
+        cpu_parallel->parallel_for2d(passed.size(), rows, [&](size_t i, size_t r) {
+            const size_t row = passed[i] * rows + r;
+            std::memcpy(dst_ptr + row * N * elem, main_ptr + row * N * elem, N * elem);
+        });
+    }
+    if (max_rows == 0) {
+        return;
+    }
+
+    // the gathered rows of x and of the main flow (accumulating the result), the low-rank product in f32 and scaled
+    auto align = [](size_t size) {
+        return rnd_up(size, 64);
+    };
+    const size_t x_size = align(max_rows * K * elem);
+    const size_t out_size = align(max_rows * N * elem);
+    const size_t low_rank_size = align(max_rows * max_rank * sizeof(float));
+    m_scratch.resize(x_size + out_size + low_rank_size + max_rows * max_rank * elem);
+    auto* x_rows = m_scratch.data();
+    auto* out_rows = x_rows + x_size;
+    auto* low_rank = reinterpret_cast<float*>(out_rows + out_size);
+    auto* scaled_low_rank = out_rows + out_size + low_rank_size;
+
+    using dims = dnnl::memory::dims;
+    const auto dataType = DnnlExtensionUtils::ElementTypeToDataType(m_precision);
+    for (size_t id = 0; id < buckets.size(); id++) {
+        const auto& bucket = buckets[id];
+        if (bucket.empty()) {
+            continue;
+        }
+        const size_t begin = rank_offsets[id];
+        const size_t adapter_rank = rank_offsets[id + 1] - begin;
+        const size_t M = bucket.size() * rows;
+        const auto m = static_cast<dnnl::memory::dim>(M);
+        const auto k = static_cast<dnnl::memory::dim>(K);
+        const auto n = static_cast<dnnl::memory::dim>(N);
+        const auto r = static_cast<dnnl::memory::dim>(adapter_rank);
+
+        cpu_parallel->parallel_for2d(bucket.size(), rows, [&](size_t i, size_t row) {
+            const size_t src_row = bucket[i] * rows + row;
+            const size_t dst_row = i * rows + row;
+            std::memcpy(x_rows + dst_row * K * elem, x_ptr + src_row * K * elem, K * elem);
+            std::memcpy(out_rows + dst_row * N * elem, main_ptr + src_row * N * elem, N * elem);
+        });
+
+        // x_i * A_i^T
+        dnnl::memory x_mem({dims{m, k}, dataType, dims{k, 1}}, m_engine, x_rows);
+        dnnl::memory a_mem({dims{k, r}, dataType, dims{1, k}},
+                           m_engine,
+                           const_cast<uint8_t*>(static_cast<const uint8_t*>(a) + begin * K * elem));
+        dnnl::memory low_rank_mem({dims{m, r}, dnnl::memory::data_type::f32, dims{r, 1}}, m_engine, low_rank);
+        getMatMul(K, adapter_rank, K, false)
+            .execute(strm, {{DNNL_ARG_SRC, x_mem}, {DNNL_ARG_WEIGHTS, a_mem}, {DNNL_ARG_DST, low_rank_mem}});
+
+        const auto* adapter_alpha = static_cast<const uint8_t*>(alpha) + begin * elem;
+        switch (m_precision) {
+        case ov::element::f32:
+            scale_low_rank(low_rank,
+                           reinterpret_cast<const float*>(adapter_alpha),
+                           reinterpret_cast<float*>(scaled_low_rank),
+                           M,
+                           adapter_rank,
+                           cpu_parallel);
+            break;
+        case ov::element::bf16:
+            scale_low_rank(low_rank,
+                           reinterpret_cast<const ov::bfloat16*>(adapter_alpha),
+                           reinterpret_cast<ov::bfloat16*>(scaled_low_rank),
+                           M,
+                           adapter_rank,
+                           cpu_parallel);
+            break;
+        default:
+            scale_low_rank(low_rank,
+                           reinterpret_cast<const ov::float16*>(adapter_alpha),
+                           reinterpret_cast<ov::float16*>(scaled_low_rank),
+                           M,
+                           adapter_rank,
+                           cpu_parallel);
+            break;
+        }
+
+        // main_i + (...) * B_i^T, B_i are the columns [begin, begin + adapter_rank) of B
+        dnnl::memory scaled_mem({dims{m, r}, dataType, dims{r, 1}}, m_engine, scaled_low_rank);
+        dnnl::memory b_mem({dims{r, n}, dataType, dims{1, static_cast<dnnl::memory::dim>(rank)}},
+                           m_engine,
+                           const_cast<uint8_t*>(static_cast<const uint8_t*>(b) + begin * elem));
+        dnnl::memory out_mem({dims{m, n}, dataType, dims{n, 1}}, m_engine, out_rows);
+        getMatMul(adapter_rank, N, rank, true)
+            .execute(strm, {{DNNL_ARG_SRC, scaled_mem}, {DNNL_ARG_WEIGHTS, b_mem}, {DNNL_ARG_DST, out_mem}});
+
+        cpu_parallel->parallel_for2d(bucket.size(), rows, [&](size_t i, size_t row) {
+            const size_t dst_row = bucket[i] * rows + row;
+            std::memcpy(dst_ptr + dst_row * N * elem, out_rows + (i * rows + row) * N * elem, N * elem);
+        });
+    }
+}
+
+}  // namespace ov::intel_cpu
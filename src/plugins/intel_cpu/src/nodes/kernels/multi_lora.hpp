@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <tuple>
+#include <vector>
+
+#include "cpu_parallel.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Applies a different LoRA adapter to each batch element, the adapters are stacked along the rank dimension
+ * of the LoRA matrices: dst = main + ((x * A^T) * alpha) * B^T, where A, alpha and B are the rank ranges of the adapter
+ * of the batch element. The rows of the batch elements are bucketed by the adapter, so each adapter is applied by two
+ * GEMMs (oneDNN matmul with the runtime number of rows): x_i * A_i^T and then (* alpha_i) * B_i^T accumulated onto the
+ * gathered main flow.
+ */
+class MultiLoRA {
+public:
+    /**
+     * @param precision Precision of all the tensors, f32, bf16 or f16.
+     */
+    MultiLoRA(dnnl::engine engine, ov::element::Type precision);
+
+    /**
+     * @param main Main flow [batch * rows, N], may be the same as dst.
+     * @param x LoRA input [batch * rows, K].
+     * @param a Stacked A matrices [rank, K].
+     * @param alpha Stacked alphas [rank].
+     * @param b Stacked B matrices [N, rank].
+     * @param dst Output [batch * rows, N].
+     * @param rows Number of the rows of a batch element.
+     * @param rank Total rank of the stacked adapters.
+     * @param rank_offsets Adapter i occupies the ranks [rank_offsets[i], rank_offsets[i + 1]).
+     * @param adapter_ids Adapter of each batch element, negative for none.
+     */
+    void execute(const dnnl::stream& strm,
+                 const void* main,
+                 const void* x,
+                 const void* a,
+                 const void* alpha,
+                 const void* b,
+                 void* dst,
+                 size_t rows,
+                 size_t K,
+                 size_t N,
+                 size_t rank,
+                 const std::vector<size_t>& rank_offsets,
+                 const std::vector<int32_t>& adapter_ids,
+                 const CpuParallelPtr& cpu_parallel);
+
+private:
+    // [M, K] * [K, N] with the runtime M, the weights are the transposed rows of the matrix with the leading
+    // dimension ldb; accumulate defines whether the product is added to dst (the gathered main flow)
+    const dnnl::matmul& getMatMul(size_t K, size_t N, size_t ldb, bool accumulate);
+
+    dnnl::engine m_engine;
+    ov::element::Type m_precision;
+    std::map<std::tuple<size_t, size_t, size_t, bool>, dnnl::matmul> m_matmuls;
+    std::vector<uint8_t> m_scratch;
+};
+
+}  // namespace ov::intel_cpu
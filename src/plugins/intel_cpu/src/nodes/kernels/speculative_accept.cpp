@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "speculative_accept.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#include "cpu_parallel.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+int32_t argmax(const float* p, size_t vocab_size) {
+    return static_cast<int32_t>(std::max_element(p, p + vocab_size) - p);
+}
+
+// Samples a token from max(0, p - q) normalized, where q is one-hot at the draft token without the draft
+// probabilities. Without the draft token as well it samples from p.
+int32_t sample(const float* p, const float* q, int32_t draft_token, size_t vocab_size, float u) {
+    auto weight = [&](size_t i) {
+        const float q_i = q ? q[i] : static_cast<float>(static_cast<int32_t>(i) == draft_token);
+        return std::max(p[i] - q_i, 0.F);
+    };
+    float total = 0.F;
+    for (size_t i = 0; i < vocab_size; i++) {
+        total += weight(i);
+    }
+    if (total <= 0.F) {
+        // the distributions are the same, which may happen only because of the rounding
+        return draft_token < 0 ? argmax(p, vocab_size) : sample(p, nullptr, -1, vocab_size, u);
+    }
+    float target = u * total;
+    int32_t last = 0;
+    for (size_t i = 0; i < vocab_size; i++) {
+        const auto w = weight(i);
+        if (w <= 0.F) {
+            continue;
+        }
+        last = static_cast<int32_t>(i);
+        target -= w;
+        if (target < 0.F) {
+            break;
+        }
+    }
+    return last;
+}
+
+}  // namespace
+
+void speculative_accept(const float* probs,
+                        const int32_t* draft_tokens,
+                        const float* draft_probs,
+                        int32_t* tokens,
+                        int32_t* accepted,
+                        size_t batch,
+                        size_t draft_len,
+                        size_t vocab_size,
+                        bool greedy,
+                        uint64_t seed,
+                        const CpuParallelPtr& cpu_parallel) {
+    cpu_parallel->parallel_for(batch, [&](size_t b) {
+        std::seed_seq seeds{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32), static_cast<uint32_t>(b)};
+        std::mt19937 gen(seeds);
+        std::uniform_real_distribution<float> uniform(0.F, 1.F);
+
+        const auto* p = probs + b * (draft_len + 1) * vocab_size;
+        const auto* draft = draft_tokens + b * draft_len;
+        auto* out = tokens + b * (draft_len + 1);
+
+        size_t n = 0;
+        int32_t next = -1;
+        for (; n < draft_len; n++, p += vocab_size) {
+            const auto draft_token = draft[n];
+            if (greedy) {
+                const auto best = argmax(p, vocab_size);
+                if (best != draft_token) {
+                    next = best;
+                    break;
+                }
+            } else {
+                const auto* q = draft_probs ? draft_probs + (b * draft_len + n) * vocab_size : nullptr;
+                const float q_draft = q ? q[draft_token] : 1.F;
+                // accepted with the probability min(1, p / q)
+                if (uniform(gen) * q_draft >= p[draft_token]) {
+                    next = sample(p, q, draft_token, vocab_size, uniform(gen));
+                    break;
+                }
+            }
+            out[n] = draft_token;
+        }
+        if (n == draft_len) {
+            // the bonus token
+            next = greedy ? argmax(p, vocab_size) : sample(p, nullptr, -1, vocab_size, uniform(gen));
+        }
+        out[n] = next;
+        std::fill(out + n + 1, out + draft_len + 1, -1);
+        accepted[b] = static_cast<int32_t>(n);
+    });
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,36 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "cpu_parallel.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Accepts or rejects the draft tokens of speculative decoding, see SpeculativeAcceptNode.
+ * @param probs Target probabilities [batch, draft_len + 1, vocab_size].
+ * @param draft_tokens Draft tokens [batch, draft_len], valid ones.
+ * @param draft_probs Draft probabilities [batch, draft_len, vocab_size], nullptr for a deterministic draft.
+ * @param tokens Output tokens [batch, draft_len + 1].
+ * @param accepted Output numbers of the accepted draft tokens [batch].
+ * @param greedy Compare the draft tokens with the most probable ones instead of sampling.
+ * @param seed Seed of the random numbers, each batch draws its own sequence of them.
+ */
+void speculative_accept(const float* probs,
+                        const int32_t* draft_tokens,
+                        const float* draft_probs,
+                        int32_t* tokens,
+                        int32_t* accepted,
+                        size_t batch,
+                        size_t draft_len,
+                        size_t vocab_size,
+                        bool greedy,
+                        uint64_t seed,
+                        const CpuParallelPtr& cpu_parallel);
+
+}  // namespace ov::intel_cpu
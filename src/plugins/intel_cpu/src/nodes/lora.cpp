@@ -4,22 +4,34 @@
 
 #include "lora.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 #include <vector>
 
 #include "allocation_context.hpp"
+#include "cpu_types.h"
 #include "graph_context.h"
 #include "memory_desc/blocked_memory_desc.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
 #include "node.h"
 #include "nodes/input.h"
+#include "nodes/kernels/multi_lora.hpp"
 #include "nodes/node_config.h"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
+#include "openvino/core/partial_shape.hpp"
 #include "openvino/core/type.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
 #include "ov_ops/lora_subgraph.hpp"
 #include "shape_inference/shape_inference_pass_through.hpp"
 
@@ -51,6 +63,20 @@ LoRA::LoRA(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& contex
                     op->get_friendly_name());
 
     m_body = loraModel->get_function();
+    const auto& ops = m_body->get_ops();
+    m_multiAdapterSupported = std::all_of(ops.begin(), ops.end(), [](const std::shared_ptr<ov::Node>& node) {
+        if (const auto matmul = ov::as_type_ptr<ov::op::v0::MatMul>(node)) {
+            return !matmul->get_transpose_a() && matmul->get_transpose_b();
+        }
+        return ov::is_type_any_of<ov::op::v0::Parameter, ov::op::v1::Multiply, ov::op::v1::Add, ov::op::v0::Result>(
+            node);
+    });
+}
+
+void LoRA::enableMultipleAdapters() {
+    CPU_NODE_ASSERT(m_multiAdapterSupported,
+                    "supports multiple adapters only for the LoRA matrices multiplied as transposed");
+    m_multipleAdapters = true;
 }
 
 void LoRA::selectOptimalPrimitiveDescriptor() {
@@ -60,6 +86,10 @@ void LoRA::selectOptimalPrimitiveDescriptor() {
 
     auto mainInputDesc = getParentOutputMemDesc(getParentEdgeAt(0));
     auto mainInputPrc = mainInputDesc->getPrecision();  // we have to align precision across all the inputs
+    // the multi-adapter kernel works with the planar layout only
+    if (m_multipleAdapters) {
+        mainInputDesc = std::make_shared<CpuBlockedMemoryDesc>(mainInputPrc, getInputShapeAtPort(0));
+    }
 
     inConfs.emplace_back(mainInputDesc);
 
@@ -67,7 +97,9 @@ void LoRA::selectOptimalPrimitiveDescriptor() {
     graphInputConfig.emplace_back(node::Input::InputConfig{mainInputDesc, isInPlace});
 
     for (size_t i = 1; i < getParentEdges().size(); i++) {
-        auto desc = getParentOutputMemDesc(getParentEdgeAt(i))->cloneWithNewPrecision(mainInputPrc);
+        auto desc = m_multipleAdapters
+                        ? std::make_shared<CpuBlockedMemoryDesc>(mainInputPrc, getInputShapeAtPort(i))
+                        : getParentOutputMemDesc(getParentEdgeAt(i))->cloneWithNewPrecision(mainInputPrc);
         inConfs.emplace_back(desc);
         graphInputConfig.emplace_back(node::Input::InputConfig{desc, isInPlace});
     }
@@ -138,12 +170,66 @@ void LoRA::createPrimitive() {
     }
 
     m_graph.Activate();
+
+    if (m_multipleAdapters) {
+        m_multiLoRA = std::make_unique<MultiLoRA>(getEngine(), getSrcMemoryAtPort(MAIN_PORT)->getPrecision());
+    }
 }
 
 void LoRA::execute([[maybe_unused]] const dnnl::stream& strm) {
+    if (m_adapters) {
+        executeMultiAdapter(strm);
+        return;
+    }
     m_graph.Infer();
 }
 
+void LoRA::executeMultiAdapter(const dnnl::stream& strm) {
+    CPU_NODE_ASSERT(m_multiLoRA, "is not compiled for multiple adapters");
+    const auto& ids = m_adapters->ids;
+    const auto& offsets = m_adapters->rank_offsets;
+    const auto& mainDims = getSrcMemoryAtPort(MAIN_PORT)->getStaticDims();
+    const auto& xDims = getSrcMemoryAtPort(X_PORT)->getStaticDims();
+    const auto& aDims = getSrcMemoryAtPort(A_PORT)->getStaticDims();
+    const auto& bDims = getSrcMemoryAtPort(B_PORT)->getStaticDims();
+    CPU_NODE_ASSERT(xDims.size() > 1 && xDims[0] == ids.size(),
+                    "has ",
+                    ids.size(),
+                    " LoRA adapter ids for the input of shape ",
+                    PartialShape(xDims));
+
+    const size_t batch = ids.size();
+    const size_t K = xDims.back();
+    const size_t N = mainDims.back();
+    const size_t rank = aDims[0];
+    const size_t rows = std::accumulate(xDims.begin() + 1, xDims.end() - 1, size_t{1}, std::multiplies<>());
+    CPU_NODE_ASSERT(aDims == VectorDims({rank, K}) && bDims == VectorDims({N, rank}) &&
+                        getSrcMemoryAtPort(ALPHA_PORT)->getShape().getElementsCount() == rank,
+                    "has incompatible LoRA matrices of shapes ",
+                    PartialShape(aDims),
+                    ", ",
+                    PartialShape(bDims));
+    CPU_NODE_ASSERT(getSrcMemoryAtPort(MAIN_PORT)->getShape().getElementsCount() == batch * rows * N,
+                    "has incompatible main flow of shape ",
+                    PartialShape(mainDims));
+    CPU_NODE_ASSERT(offsets.back() <= rank, "has LoRA adapters of the total rank ", offsets.back(), " over ", rank);
+
+    m_multiLoRA->execute(strm,
+                         getSrcDataAtPort(MAIN_PORT),
+                         getSrcDataAtPort(X_PORT),
+                         getSrcDataAtPort(A_PORT),
+                         getSrcDataAtPort(ALPHA_PORT),
+                         getSrcDataAtPort(B_PORT),
+                         getDstDataAtPort(0),
+                         rows,
+                         K,
+                         N,
+                         rank,
+                         offsets,
+                         ids,
+                         context->getCpuParallel());
+}
+
 void LoRA::executeDynamicImpl(const dnnl::stream& strm) {
     execute(strm);
 }
@@ -7,6 +7,7 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "allocation_context.hpp"
@@ -14,7 +15,9 @@
 #include "cpu_types.h"
 #include "graph.h"
 #include "graph_context.h"
+#include "lora_adapters.hpp"
 #include "node.h"
+#include "nodes/kernels/multi_lora.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/core/node.hpp"
 
@@ -38,10 +41,30 @@ public:
     void execute([[maybe_unused]] const dnnl::stream& strm) override;
     void executeDynamicImpl(const dnnl::stream& strm) override;
 
+    // the adapters are selected per batch element (see LoraAdapters), must be called before the layouts are selected
+    void enableMultipleAdapters();
+
+    void setAdapters(LoraAdaptersCPtr adapters) {
+        m_adapters = std::move(adapters);
+    }
+
 private:
+    static constexpr size_t MAIN_PORT = 0LU;
+    static constexpr size_t X_PORT = 1LU;
+    static constexpr size_t A_PORT = 2LU;
+    static constexpr size_t ALPHA_PORT = 3LU;
+    static constexpr size_t B_PORT = 4LU;
+
+    void executeMultiAdapter(const dnnl::stream& strm);
+
     std::shared_ptr<const ov::Model> m_body;
     std::vector<MemoryPtr> subgraphMemoryPtrs;
     Graph m_graph;
+    // the body is x * A^T * alpha * B^T, which the multi-adapter kernel computes
+    bool m_multiAdapterSupported = false;
+    bool m_multipleAdapters = false;
+    LoraAdaptersCPtr m_adapters;
+    std::unique_ptr<MultiLoRA> m_multiLoRA;
 };
 
 }  // namespace ov::intel_cpu::node
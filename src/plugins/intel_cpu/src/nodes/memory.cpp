@@ -1115,7 +1115,11 @@ MemStatePtr MemoryInputSDPA::makeState() const {
 
     auto internal_desc = ArbitraryOrderDescCreator(order).createSharedDesc(kv_precision, internal_shape);
 
-    return std::make_shared<VariableStateKVcache>(state_name, original_desc, internal_desc, quant_param);
+    return std::make_shared<VariableStateKVcache>(state_name,
+                                                  original_desc,
+                                                  internal_desc,
+                                                  quant_param,
+                                                  context->getConfig().kvCacheNativeState);
 }
 
 void MemoryInputSDPA::runStatic(dnnl::stream strm) {
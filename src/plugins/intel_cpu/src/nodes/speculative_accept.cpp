@@ -0,0 +1,126 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "speculative_accept.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+#include <vector>
+
+#include "cpu_types.h"
+#include "graph_context.h"
+#include "memory_desc/cpu_memory_desc.h"
+#include "node.h"
+#include "nodes/kernels/speculative_accept.hpp"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "shape_inference/shape_inference_cpu.hpp"
+#include "transformations/cpu_opset/common/op/speculative_accept.hpp"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu::node {
+
+bool SpeculativeAccept::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
+                                             std::string& errorMessage) noexcept {
+    try {
+        if (!ov::as_type_ptr<const SpeculativeAcceptNode>(op)) {
+            errorMessage = "Only SpeculativeAccept from CPU internal opset is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+SpeculativeAccept::SpeculativeAccept(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context)
+    : Node(op, context, NgraphShapeInferFactory(op)) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
+    }
+
+    const auto accept = ov::as_type_ptr<const SpeculativeAcceptNode>(op);
+    m_greedy = accept->get_greedy();
+    m_global_seed = accept->get_global_seed();
+    m_op_seed = accept->get_op_seed();
+    m_with_draft_probs = op->get_input_size() > DRAFT_PROBS_PORT;
+
+    constant = ConstantType::StrictNoConst;
+}
+
+void SpeculativeAccept::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty()) {
+        return;
+    }
+
+    std::vector<PortConfigurator> inConfs{{LayoutType::ncsp, ov::element::f32},
+                                          {LayoutType::ncsp, ov::element::i32}};
+    if (m_with_draft_probs) {
+        inConfs.emplace_back(LayoutType::ncsp, ov::element::f32);
+    }
+    addSupportedPrimDesc(inConfs,
+                         {{LayoutType::ncsp, ov::element::i32}, {LayoutType::ncsp, ov::element::i32}},
+                         ref_any);
+}
+
+bool SpeculativeAccept::created() const {
+    return getType() == Type::SpeculativeAccept;
+}
+
+void SpeculativeAccept::execute([[maybe_unused]] const dnnl::stream& strm) {
+    const auto& probs_dims = getSrcMemoryAtPort(PROBS_PORT)->getStaticDims();
+    const size_t batch = probs_dims[0];
+    const size_t draft_len = probs_dims[1] - 1;
+    const size_t vocab_size = probs_dims[2];
+
+    const auto* draft_tokens = getSrcDataAtPortAs<const int32_t>(DRAFT_TOKENS_PORT);
+    for (size_t i = 0; i < batch * draft_len; i++) {
+        CPU_NODE_ASSERT(draft_tokens[i] >= 0 && static_cast<size_t>(draft_tokens[i]) < vocab_size,
+                        "has draft token ",
+                        draft_tokens[i],
+                        " out of the vocabulary of size ",
+                        vocab_size);
+    }
+    const float* draft_probs = nullptr;
+    if (m_with_draft_probs) {
+        const auto& draft_probs_dims = getSrcMemoryAtPort(DRAFT_PROBS_PORT)->getStaticDims();
+        CPU_NODE_ASSERT(draft_probs_dims == VectorDims({batch, draft_len, vocab_size}),
+                        "has incompatible draft probabilities shape ",
+                        PartialShape(draft_probs_dims));
+        draft_probs = getSrcDataAtPortAs<const float>(DRAFT_PROBS_PORT);
+    }
+
+    // the same as Multinomial, the seeds make the results reproducible, without them the time is used
+    uint64_t seed = m_global_seed ^ (m_op_seed << 1);
+    if (all_of(0U, m_global_seed, m_op_seed)) {
+        seed = static_cast<uint64_t>(std::time(nullptr));
+    }
+    seed += m_executions++;
+
+    speculative_accept(getSrcDataAtPortAs<const float>(PROBS_PORT),
+                       draft_tokens,
+                       draft_probs,
+                       getDstDataAtPortAs<int32_t>(TOKENS_PORT),
+                       getDstDataAtPortAs<int32_t>(ACCEPTED_PORT),
+                       batch,
+                       draft_len,
+                       vocab_size,
+                       m_greedy,
+                       seed,
+                       context->getCpuParallel());
+}
+
+void SpeculativeAccept::executeDynamicImpl(const dnnl::stream& strm) {
+    execute(strm);
+}
+
+}  // namespace ov::intel_cpu::node
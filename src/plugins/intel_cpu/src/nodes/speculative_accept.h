@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <oneapi/dnnl/dnnl_common.hpp>
+#include <string>
+
+#include "graph_context.h"
+#include "openvino/core/node.hpp"
+
+namespace ov::intel_cpu::node {
+
+class SpeculativeAccept : public Node {
+public:
+    SpeculativeAccept(const std::shared_ptr<ov::Node>& op, const GraphContext::CPtr& context);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void execute(const dnnl::stream& strm) override;
+    bool created() const override;
+    bool needPrepareParams() const override {
+        return false;
+    }
+
+    static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
+
+protected:
+    void executeDynamicImpl(const dnnl::stream& strm) override;
+
+private:
+    static constexpr size_t PROBS_PORT = 0LU;
+    static constexpr size_t DRAFT_TOKENS_PORT = 1LU;
+    static constexpr size_t DRAFT_PROBS_PORT = 2LU;
+    static constexpr size_t TOKENS_PORT = 0LU;
+    static constexpr size_t ACCEPTED_PORT = 1LU;
+
+    bool m_greedy = false;
+    bool m_with_draft_probs = false;
+    uint64_t m_global_seed = 0;
+    uint64_t m_op_seed = 0;
+    // number of the executions, so each of them draws new random numbers
+    uint64_t m_executions = 0;
+};
+
+}  // namespace ov::intel_cpu::node
@@ -429,7 +429,9 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         }
     }
 #endif
-    return std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    auto compiled_model = std::make_shared<CompiledModel>(cloned_model, shared_from_this(), conf, false);
+    compiled_model->warm_up_runtime_cache();
+    return compiled_model;
 }
 
 void Plugin::set_property(const ov::AnyMap& config) {
@@ -819,7 +821,14 @@ std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer&
 
     // import config props from caching model
     calculate_streams(conf, model, true);
-    auto compiled_model = std::make_shared<CompiledModel>(model, shared_from_this(), conf, loaded_from_cache);
+    auto compiled_model = std::make_shared<CompiledModel>(model,
+                                                          shared_from_this(),
+                                                          conf,
+                                                          loaded_from_cache,
+                                                          nullptr,
+                                                          deserializer.repacked_weights(),
+                                                          deserializer.constant_offsets());
+    compiled_model->warm_up_runtime_cache();
     return compiled_model;
 }
 }  // namespace ov::intel_cpu
@@ -0,0 +1,89 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "speculative_accept.hpp"
+
+#include <cstdint>
+#include <memory>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/dimension.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/core/partial_shape.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/op.hpp"
+#include "transformations/itt.hpp"
+
+ov::intel_cpu::SpeculativeAcceptNode::SpeculativeAcceptNode(const ov::OutputVector& args,
+                                                             bool greedy,
+                                                             uint64_t global_seed,
+                                                             uint64_t op_seed)
+    : Op(args),
+      m_greedy(greedy),
+      m_global_seed(global_seed),
+      m_op_seed(op_seed) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ov::intel_cpu::SpeculativeAcceptNode::clone_with_new_inputs(
+    const ov::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(SpeculativeAcceptNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::SpeculativeAcceptNode>(new_args, m_greedy, m_global_seed, m_op_seed);
+}
+
+bool ov::intel_cpu::SpeculativeAcceptNode::visit_attributes(ov::AttributeVisitor& visitor) {
+    INTERNAL_OP_SCOPE(SpeculativeAcceptNode_visit_attributes);
+    visitor.on_attribute("greedy", m_greedy);
+    visitor.on_attribute("global_seed", m_global_seed);
+    visitor.on_attribute("op_seed", m_op_seed);
+    return true;
+}
+
+void ov::intel_cpu::SpeculativeAcceptNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(SpeculativeAcceptNode_validate_and_infer_types);
+    OPENVINO_ASSERT(get_input_size() == 2 || get_input_size() == 3, "SpeculativeAccept expects 2 or 3 inputs");
+
+    const auto& probs_et = get_input_element_type(0);
+    const auto& probs_shape = get_input_partial_shape(0);
+    OPENVINO_ASSERT(probs_et.is_real(), "'probs' input must be real whereas current element type is ", probs_et);
+    OPENVINO_ASSERT(probs_shape.rank().compatible(3),
+                    "'probs' input must have 3D shape whereas current shape is ",
+                    probs_shape);
+
+    const auto& draft_et = get_input_element_type(1);
+    const auto& draft_shape = get_input_partial_shape(1);
+    OPENVINO_ASSERT(draft_et.is_integral_number(),
+                    "'draft_tokens' input must be integer whereas current element type is ",
+                    draft_et);
+    OPENVINO_ASSERT(draft_shape.rank().compatible(2),
+                    "'draft_tokens' input must have 2D shape whereas current shape is ",
+                    draft_shape);
+
+    auto batch = Dimension::dynamic();
+    auto tokens = Dimension::dynamic();
+    if (probs_shape.rank().is_static()) {
+        batch = probs_shape[0];
+        tokens = probs_shape[1];
+    }
+    if (draft_shape.rank().is_static()) {
+        OPENVINO_ASSERT(Dimension::merge(batch, batch, draft_shape[0]),
+                        "'probs' and 'draft_tokens' inputs must have the same batch");
+        OPENVINO_ASSERT(Dimension::merge(tokens, tokens, draft_shape[1] + 1),
+                        "'probs' input must have one more token than 'draft_tokens' input");
+    }
+
+    if (get_input_size() == 3) {
+        const auto& draft_probs_shape = get_input_partial_shape(2);
+        OPENVINO_ASSERT(get_input_element_type(2).is_real(), "'draft_probs' input must be real");
+        OPENVINO_ASSERT(draft_probs_shape.rank().compatible(3),
+                        "'draft_probs' input must have 3D shape whereas current shape is ",
+                        draft_probs_shape);
+    }
+
+    set_output_type(0, ov::element::i32, ov::PartialShape{batch, tokens});
+    set_output_type(1, ov::element::i32, ov::PartialShape{batch});
+}
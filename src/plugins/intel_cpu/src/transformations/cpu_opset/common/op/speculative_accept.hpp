@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "openvino/core/attribute_visitor.hpp"
+#include "openvino/core/node.hpp"
+#include "openvino/core/node_vector.hpp"
+#include "openvino/op/op.hpp"
+
+namespace ov::intel_cpu {
+/**
+ * The operation verifies the draft tokens of speculative decoding against the probabilities of the target model
+ * computed for all of them in one inference. A draft token is accepted with the probability min(1, p / q), where p and
+ * q are the target and the draft probabilities of the token (q is 1 without the draft probabilities, e.g. for prompt
+ * lookup), the first rejected one is replaced by a token sampled from the normalized max(0, p - q). If all the draft
+ * tokens are accepted, the bonus token is sampled from the last target probabilities. In the greedy mode a draft token
+ * is accepted if it's the most probable one, and the replacement is the most probable token.
+ * Inputs:
+ *     1. Target probabilities of type T1 - shape [B, K + 1, V], where K - number of the draft tokens, V - vocabulary
+ *        size. Required
+ *     2. Draft tokens of type T2 - shape [B, K]. Required
+ *     3. Draft probabilities of type T1 - shape [B, K, V]. Optional
+ * Outputs:
+ *     1. Tokens of type I32 - shape [B, K + 1]. The accepted draft tokens followed by the replacement or the bonus
+ *        token, the rest is filled with -1
+ *     2. Number of the accepted draft tokens of type I32 - shape [B]
+ * Types:
+ *     T1 - only FP32 is supported
+ *     T2 - I32 and I64 are supported
+ */
+class SpeculativeAcceptNode : public ov::op::Op {
+public:
+    OPENVINO_OP("SpeculativeAccept", "cpu_plugin_opset");
+
+    SpeculativeAcceptNode() = default;
+    SpeculativeAcceptNode(const ov::OutputVector& args, bool greedy, uint64_t global_seed = 0, uint64_t op_seed = 0);
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+    bool visit_attributes(ov::AttributeVisitor& visitor) override;
+    void validate_and_infer_types() override;
+
+    bool get_greedy() const {
+        return m_greedy;
+    }
+    uint64_t get_global_seed() const {
+        return m_global_seed;
+    }
+    uint64_t get_op_seed() const {
+        return m_op_seed;
+    }
+
+private:
+    bool m_greedy = false;
+    uint64_t m_global_seed = 0;
+    uint64_t m_op_seed = 0;
+};
+}  // namespace ov::intel_cpu
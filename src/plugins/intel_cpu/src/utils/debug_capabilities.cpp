@@ -718,6 +718,12 @@ std::ostream& operator<<(std::ostream& os, const MemoryStatisticsRecord& record)
     os << "Total size: " << record.total_size << " bytes\n";
     os << "Optimal total size: " << record.optimal_total_size << " bytes\n";
     os << "Max region size: " << record.max_region_size << " bytes\n";
+    os << "Total solves: " << record.total_solves << "\n";
+    os << "Total reallocations: " << record.total_reallocations << "\n";
+    if (record.total_inferences > 0) {
+        os << "Reallocations per inference: "
+           << static_cast<double>(record.total_reallocations) / static_cast<double>(record.total_inferences) << "\n";
+    }
     return os;
 }
 
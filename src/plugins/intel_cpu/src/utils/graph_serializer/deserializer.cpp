@@ -27,7 +27,9 @@
 #include "openvino/core/shape.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/op/util/variable.hpp"
 #include "openvino/opsets/opset.hpp"
 #include "openvino/pass/serialize.hpp"
@@ -40,6 +42,7 @@
 #include "openvino/util/xml_parse_utils.hpp"
 #include "openvino/xml_util/xml_deserialize_util.hpp"
 #include "utils/codec_xor.hpp"
+#include "utils/graph_serializer/repacked_weights.hpp"
 
 namespace ov::intel_cpu {
 
@@ -149,7 +152,16 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
     // Blob from cache may have other header, so need to skip this.
     auto* buffer_base = reinterpret_cast<char*>(model_buffer->get_ptr());
 
-    const auto file_size = model_buffer->size();
+    auto file_size = model_buffer->size();
+    // the optional repacked weights section follows the model
+    if (const auto section_size = RepackedWeightsSection::size(buffer_base, file_size)) {
+        file_size -= section_size;
+        m_repacked_weights = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(
+            buffer_base + file_size,
+            section_size,
+            model_buffer);
+    }
+
     pass::StreamSerialize::DataHeader hdr = {};
     std::memcpy(reinterpret_cast<char*>(&hdr), buffer_base, sizeof hdr);
 
@@ -197,6 +209,9 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
         std::make_shared<ov::SharedBuffer<std::shared_ptr<std::string>>>((*xml_buff).data(), hdr.model_size, xml_buff);
 
     model = create_ov_model(model_buf, weights_buf, m_origin_weights_buf);
+    if (m_repacked_weights && weights_buf) {
+        collect_constant_offsets(*model, *weights_buf);
+    }
 
     // Set Info
     pugi::xml_node root = xml_in_out_doc.child("cnndata");
@@ -209,9 +224,25 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
 
     const size_t hdr_pos = model_stream.tellg();
     model_stream.seekg(0, std::istream::end);
-    const size_t file_size = model_stream.tellg();
+    size_t file_size = model_stream.tellg();
     model_stream.seekg(hdr_pos, std::istream::beg);
 
+    // the optional repacked weights section follows the model
+    if (const auto section_size = RepackedWeightsSection::size(model_stream, file_size)) {
+        file_size -= section_size;
+        // keep the alignment of the section data with respect to the stream, so the records are not copied again
+        const auto shift = file_size % RepackedWeightsSection::dataAlignment;
+        auto section_buf =
+            std::make_shared<ov::AlignedBuffer>(section_size + shift, RepackedWeightsSection::dataAlignment);
+        m_repacked_weights = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(
+            section_buf->get_ptr<char>() + shift,
+            section_size,
+            section_buf);
+        model_stream.seekg(static_cast<std::streamoff>(file_size), std::istream::beg);
+        model_stream.read(m_repacked_weights->get_ptr<char>(), section_size);
+        model_stream.seekg(hdr_pos, std::istream::beg);
+    }
+
     pass::StreamSerialize::DataHeader hdr = {};
     model_stream.read(reinterpret_cast<char*>(&hdr), sizeof(hdr));
 
@@ -268,12 +299,35 @@ void ModelDeserializer::process_model(std::shared_ptr<ov::Model>& model,
         data_blob);
 
     model = create_ov_model(model_buf, weights_buf, m_origin_weights_buf);
+    if (m_repacked_weights) {
+        collect_constant_offsets(*model, *weights_buf);
+    }
 
     // Set Info
     pugi::xml_node root = xmlInOutDoc.child("cnndata");
     set_info(root, model);
 };
 
+void ModelDeserializer::collect_constant_offsets(const ov::Model& model, const ov::AlignedBuffer& weights) {
+    if (!m_constant_offsets) {
+        m_constant_offsets = std::make_shared<ConstantOffsets>();
+    }
+    const auto begin = reinterpret_cast<uintptr_t>(weights.get_ptr());
+    for (const auto& op : model.get_ordered_ops()) {
+        if (const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op)) {
+            // the weights of the constants not aliasing the blob are identified by their content
+            const auto data = reinterpret_cast<uintptr_t>(constant->get_data_ptr());
+            if (constant->get_byte_size() != 0 && data >= begin && data - begin < weights.size()) {
+                m_constant_offsets->emplace(constant->get_data_ptr(), static_cast<size_t>(data - begin));
+            }
+        } else if (const auto subgraph = ov::as_type_ptr<ov::op::util::MultiSubGraphOp>(op)) {
+            for (const auto& body : subgraph->get_functions()) {
+                collect_constant_offsets(*body, weights);
+            }
+        }
+    }
+}
+
 ov::Any XmlDeserializer::parse_weightless_cache_attribute(const pugi::xml_node& node) const {
     if (auto rt_info = node.child("rt_info")) {
         for (const auto& child : rt_info.children()) {
@@ -14,6 +14,7 @@
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/util/xml_parse_utils.hpp"
 #include "utils/codec_xor.hpp"
+#include "utils/graph_serializer/repacked_weights.hpp"
 
 namespace ov {
 class ICore;
@@ -89,6 +90,22 @@ public:
 
     void operator>>(std::shared_ptr<ov::Model>& model);
 
+    /**
+     * @brief Returns the repacked weights section of the blob (see RepackedWeightsSection) if any, the section of the
+     * blob imported from the memory is not copied
+     */
+    [[nodiscard]] const std::shared_ptr<ov::AlignedBuffer>& repacked_weights() const {
+        return m_repacked_weights;
+    }
+
+    /**
+     * @brief Returns the offsets of the data of the constants aliasing the weights of the blob, which identify the
+     * source weights of the repacked ones. They are collected if the blob has the repacked weights section only.
+     */
+    [[nodiscard]] const std::shared_ptr<ConstantOffsets>& constant_offsets() const {
+        return m_constant_offsets;
+    }
+
 protected:
     static void set_info(pugi::xml_node& root, std::shared_ptr<ov::Model>& model);
 
@@ -100,11 +117,15 @@ protected:
                                                const std::shared_ptr<ov::AlignedBuffer>& weights,
                                                const std::shared_ptr<ov::AlignedBuffer>& origin_weights);
 
+    void collect_constant_offsets(const ov::Model& model, const ov::AlignedBuffer& weights);
+
     std::variant<std::shared_ptr<ov::AlignedBuffer>, std::reference_wrapper<std::istream>> m_model;
     std::shared_ptr<ov::ICore> m_core;
     CacheDecrypt m_cache_decrypt;
     bool m_decript_from_string;
     std::shared_ptr<ov::AlignedBuffer> m_origin_weights_buf;
+    std::shared_ptr<ov::AlignedBuffer> m_repacked_weights;
+    std::shared_ptr<ConstantOffsets> m_constant_offsets;
 };
 
 }  //  namespace ov::intel_cpu
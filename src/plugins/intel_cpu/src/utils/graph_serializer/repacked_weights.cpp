@@ -0,0 +1,210 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "repacked_weights.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "dnnl_extension_utils.h"
+#include "memory_desc/cpu_memory_desc_utils.h"
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/aligned_buffer.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+// section: id, isa, number of records, records, data of the records, trailer
+// record: key size, key, descriptor size, descriptor, data offset (from the section start), data size
+// trailer: section size, signature
+constexpr char signature[8] = {'O', 'V', 'C', 'P', 'U', 'R', 'W', '2'};
+constexpr size_t trailerSize = sizeof(uint64_t) + sizeof(signature);
+
+uint64_t currentIsa() {
+    return static_cast<uint64_t>(dnnl::get_effective_cpu_isa());
+}
+
+size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+void writeValue(std::ostream& stream, uint64_t value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void writeBytes(std::ostream& stream, const void* data, size_t size) {
+    writeValue(stream, size);
+    stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+}
+
+// returns 0 if there is no signature
+uint64_t sectionSize(const char* trailer) {
+    if (std::memcmp(trailer + sizeof(uint64_t), signature, sizeof(signature)) != 0) {
+        return 0;
+    }
+    uint64_t result = 0;
+    std::memcpy(&result, trailer, sizeof(result));
+    return result;
+}
+
+class SectionReader {
+public:
+    SectionReader(const char* data, size_t size) : m_data(data), m_size(size) {}
+
+    uint64_t value() {
+        uint64_t result = 0;
+        std::memcpy(&result, advance(sizeof(result)), sizeof(result));
+        return result;
+    }
+
+    std::pair<const char*, size_t> bytes() {
+        const auto size = static_cast<size_t>(value());
+        return {advance(size), size};
+    }
+
+private:
+    const char* advance(size_t size) {
+        OPENVINO_ASSERT(size <= m_size - m_pos, "[CPU] The repacked weights section of the blob is corrupted.");
+        const auto* ptr = m_data + m_pos;
+        m_pos += size;
+        return ptr;
+    }
+
+    const char* m_data;
+    size_t m_size;
+    size_t m_pos = 0;
+};
+
+}  // namespace
+
+void RepackedWeightsSection::write(std::ostream& stream, uint64_t id, const Records& records) {
+    struct Entry {
+        const std::string& key;
+        std::vector<uint8_t> desc;
+        const MemoryPtr& memory;
+        size_t offset;
+    };
+
+    std::vector<Entry> entries;
+    size_t tableSize = 3 * sizeof(uint64_t);
+    for (const auto& [key, memory] : records) {
+        if (!memory || !memory->getDesc().isDefined()) {
+            continue;
+        }
+        std::vector<uint8_t> desc;
+        try {
+            desc = MemoryDescUtils::convertToDnnlMemoryDesc(memory->getDescPtr())->getDnnlDesc().get_blob();
+        } catch (...) {
+            continue;
+        }
+        tableSize += 4 * sizeof(uint64_t) + key.size() + desc.size();
+        entries.push_back({key, std::move(desc), memory, 0});
+    }
+
+    // the data is aligned with respect to the stream, which is the blob file (probably behind the core header)
+    const auto streamPos = stream.tellp();
+    const size_t start = streamPos < 0 ? 0 : static_cast<size_t>(streamPos);
+    size_t end = tableSize;
+    for (auto& entry : entries) {
+        entry.offset = alignUp(start + end, dataAlignment) - start;
+        end = entry.offset + entry.memory->getSize();
+    }
+
+    writeValue(stream, id);
+    writeValue(stream, currentIsa());
+    writeValue(stream, entries.size());
+    for (const auto& entry : entries) {
+        writeBytes(stream, entry.key.data(), entry.key.size());
+        writeBytes(stream, entry.desc.data(), entry.desc.size());
+        writeValue(stream, entry.offset);
+        writeValue(stream, entry.memory->getSize());
+    }
+
+    size_t pos = tableSize;
+    const std::vector<char> padding(dataAlignment, 0);
+    for (const auto& entry : entries) {
+        stream.write(padding.data(), static_cast<std::streamsize>(entry.offset - pos));
+        stream.write(static_cast<const char*>(entry.memory->getData()),
+                     static_cast<std::streamsize>(entry.memory->getSize()));
+        pos = entry.offset + entry.memory->getSize();
+    }
+
+    writeValue(stream, end + trailerSize);
+    stream.write(signature, sizeof(signature));
+}
+
+size_t RepackedWeightsSection::size(const char* data, size_t size) {
+    if (size < trailerSize) {
+        return 0;
+    }
+    const auto result = sectionSize(data + size - trailerSize);
+    return result <= size ? static_cast<size_t>(result) : 0;
+}
+
+size_t RepackedWeightsSection::size(std::istream& stream, size_t end) {
+    if (end < trailerSize) {
+        return 0;
+    }
+    const auto pos = stream.tellg();
+    char trailer[trailerSize];
+    stream.seekg(static_cast<std::streamoff>(end - trailerSize), std::istream::beg);
+    stream.read(trailer, trailerSize);
+    const auto result = stream ? sectionSize(trailer) : 0;
+    stream.clear();
+    stream.seekg(pos);
+    return result <= end ? static_cast<size_t>(result) : 0;
+}
+
+RepackedWeightsSection::Records RepackedWeightsSection::read(const std::shared_ptr<ov::AlignedBuffer>& section,
+                                                             const dnnl::engine& eng,
+                                                             uint64_t& id) {
+    const auto* data = section->get_ptr<const char>();
+    OPENVINO_ASSERT(size(data, section->size()) == section->size(),
+                    "[CPU] The repacked weights section of the blob is corrupted.");
+    SectionReader reader(data, section->size() - trailerSize);
+
+    id = reader.value();
+    Records records;
+    if (reader.value() != currentIsa()) {
+        return records;
+    }
+
+    const auto count = static_cast<size_t>(reader.value());
+    for (size_t i = 0; i < count; i++) {
+        const auto [keyData, keySize] = reader.bytes();
+        const auto [descData, descSize] = reader.bytes();
+        const auto offset = static_cast<size_t>(reader.value());
+        const auto dataSize = static_cast<size_t>(reader.value());
+        OPENVINO_ASSERT(offset <= section->size() - trailerSize && dataSize <= section->size() - trailerSize - offset,
+                        "[CPU] The repacked weights section of the blob is corrupted.");
+
+        const auto desc = DnnlExtensionUtils::makeDescriptor(
+            dnnl::memory::desc(std::vector<uint8_t>(descData, descData + descSize)));
+        OPENVINO_ASSERT(desc->getCurrentMemSize() == dataSize,
+                        "[CPU] The repacked weights section of the blob is corrupted.");
+
+        const auto* weights = data + offset;
+        MemoryPtr memory;
+        if (reinterpret_cast<uintptr_t>(weights) % dataAlignment == 0) {
+            memory = std::make_shared<Memory>(eng, desc, weights, false);
+        } else {
+            memory = std::make_shared<Memory>(eng, desc);
+            std::memcpy(memory->getData(), weights, dataSize);
+        }
+        records.emplace_back(std::string(keyData, keySize), std::move(memory));
+    }
+    return records;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "openvino/runtime/aligned_buffer.hpp"
+
+namespace ov::intel_cpu {
+
+// data address of a constant -> offset of its data in the weights of the serialized model
+using ConstantOffsets = std::unordered_map<const void*, size_t>;
+
+/**
+ * @brief The optional section of the compiled model blob carrying the weights repacked by the graph nodes (the objects
+ * of WeightsSharing::findOrCreateShared()) along with their keys and memory descriptors. The keys identify the source
+ * weights by the offsets of their data in the serialized model (see WeightsSharing::setWeightsOffsets()) qualified by
+ * the id of the section, so the imported weights are not hashed.
+ *
+ * The section is appended after the serialized model and ends with a trailer holding its size and a signature, so the
+ * deserializer can detect it without any change of the model header. The data of the records is aligned with respect
+ * to the output stream position, so the records of a blob mapped into the memory can be aliased directly. The section
+ * is tagged by the ISA of the host, the section written on another host is ignored.
+ */
+class RepackedWeightsSection {
+public:
+    using Records = std::vector<std::pair<std::string, MemoryPtr>>;
+
+    /**
+     * @brief Appends the section with the given id and records to the stream. The records which descriptors can't be
+     * represented by oneDNN are skipped.
+     */
+    static void write(std::ostream& stream, uint64_t id, const Records& records);
+
+    /**
+     * @brief Returns the size of the section (trailer included) at the end of the data, or 0 if there is no section
+     */
+    static size_t size(const char* data, size_t size);
+
+    /**
+     * @brief Same as above, the stream position is restored
+     */
+    static size_t size(std::istream& stream, size_t end);
+
+    /**
+     * @brief Parses the section. The memory objects alias the section data if it is aligned properly (so the section
+     * must outlive them), otherwise the data is copied. Returns no records if the section was written for another ISA,
+     * the id is returned anyway.
+     */
+    static Records read(const std::shared_ptr<ov::AlignedBuffer>& section, const dnnl::engine& eng, uint64_t& id);
+
+    static constexpr size_t dataAlignment = 64;
+};
+
+}  // namespace ov::intel_cpu
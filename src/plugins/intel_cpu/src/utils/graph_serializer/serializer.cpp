@@ -21,12 +21,16 @@
 #include "openvino/pass/serialize.hpp"
 #include "openvino/xml_util/constant_writer.hpp"
 #include "openvino/xml_util/xml_serialize_util.hpp"
+#include "utils/graph_serializer/repacked_weights.hpp"
 
 namespace ov::intel_cpu {
 
 class WeightlessWriter : public util::ConstantWriter {
 public:
-    explicit WeightlessWriter(util::ConstantWriter& other) : util::ConstantWriter(other), m_offset{} {}
+    WeightlessWriter(util::ConstantWriter& other, ConstantOffsets* offsets)
+        : util::ConstantWriter(other),
+          m_offset{},
+          m_offsets(offsets) {}
 
     WeightlessWriter(std::ostream& bin_file) : util::ConstantWriter(bin_file), m_offset{} {}
 
@@ -44,6 +48,10 @@ public:
             m_offset += size;
         } else {
             offset = util::ConstantWriter::write(ptr, size, new_size, compress_to_fp16, src_type, ptr_is_temporary);
+            // the data of the constant identifies the weights derived from it (see RepackedWeightsSection)
+            if (m_offsets && !ptr_is_temporary && new_size == size) {
+                m_offsets->emplace(ptr, static_cast<size_t>(offset));
+            }
         }
 
         return offset;
@@ -56,6 +64,7 @@ public:
 private:
     WeightlessWriter::FilePosition m_offset;
     bool m_skip_weights = false;
+    ConstantOffsets* m_offsets = nullptr;
 };
 
 class XmlSerializer : public util::XmlSerializer {
@@ -68,7 +77,8 @@ public:
                   bool compress_to_fp16 = false,
                   ov::element::Type output_element_type = ov::element::dynamic,
                   bool data_is_temporary = false,
-                  bool wl_mode = false)
+                  bool wl_mode = false,
+                  ConstantOffsets* constant_offsets = nullptr)
         : util::XmlSerializer(data,
                               node_type_name,
                               constant_write_handler,
@@ -77,8 +87,9 @@ public:
                               compress_to_fp16,
                               output_element_type,
                               data_is_temporary),
-          m_weightless_const_writer(constant_write_handler),
-          m_weightless_mode(wl_mode) {}
+          m_weightless_const_writer(constant_write_handler, constant_offsets),
+          m_weightless_mode(wl_mode),
+          m_constant_offsets(constant_offsets) {}
 
 private:
     bool append_rt_attribute(pugi::xml_node& node, const ov::RuntimeAttribute& attribute) override {
@@ -131,11 +142,13 @@ private:
                                                compress_to_fp16,
                                                output_element_type,
                                                data_is_temporary,
-                                               m_weightless_mode);
+                                               m_weightless_mode,
+                                               m_constant_offsets);
     }
 
     WeightlessWriter m_weightless_const_writer;
     bool m_weightless_mode = false;
+    ConstantOffsets* m_constant_offsets = nullptr;
 };
 
 ////////// ModelSerializer //////////
@@ -176,7 +189,8 @@ std::unique_ptr<util::XmlSerializer> ModelSerializer::make_serializer(pugi::xml_
                                            compress_to_fp16,
                                            output_element_type,
                                            data_is_temporary,
-                                           m_weightless_mode);
+                                           m_weightless_mode,
+                                           m_constant_offsets.get());
 }
 
 }  // namespace ov::intel_cpu
@@ -4,12 +4,14 @@
 
 #pragma once
 
+#include <memory>
 #include <ostream>
 #include <pugixml.hpp>
 #include <string>
 
 #include "openvino/core/model.hpp"
 #include "openvino/pass/serialize.hpp"
+#include "utils/graph_serializer/repacked_weights.hpp"
 
 namespace ov::intel_cpu {
 
@@ -21,6 +23,14 @@ public:
 
     void operator<<(const std::shared_ptr<ov::Model>& model);
 
+    /**
+     * @brief Returns the offsets of the data of the serialized constants in the weights of the blob (the constants
+     * which weights are not stored in the blob are not listed)
+     */
+    [[nodiscard]] const ConstantOffsets& constant_offsets() const {
+        return *m_constant_offsets;
+    }
+
 private:
     bool use_absolute_offset() override;
 
@@ -34,6 +44,7 @@ private:
                                                          bool data_is_temporary) const override;
 
     bool m_weightless_mode;
+    std::shared_ptr<ConstantOffsets> m_constant_offsets = std::make_shared<ConstantOffsets>();
 };
 
 }  // namespace ov::intel_cpu
@@ -4,6 +4,7 @@
 
 #include "memory_stats_dump.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <deque>
 #include <filesystem>
@@ -42,9 +43,12 @@ static void dumpStatistics(std::ostream& os,
             }
         }
 
-        const auto& scratchpads = ctx->getScratchPads();
-        for (size_t i = 0; i < scratchpads.size(); ++i) {
-            os << "Scratchpad " << i << " size: " << scratchpads[i]->size() << " bytes\n\n";
+        const auto& lanes = ctx->getScratchPads();
+        for (size_t lane = 0; lane < lanes.size(); ++lane) {
+            const auto& scratchpads = lanes[lane];
+            for (size_t i = 0; i < scratchpads.size(); ++i) {
+                os << "Scratchpad " << i << " lane " << lane << " size: " << scratchpads[i]->size() << " bytes\n\n";
+            }
         }
     }
     os << "Weights cache statistics\n";
@@ -53,6 +57,12 @@ static void dumpStatistics(std::ostream& os,
         os << "Socket ID: " << item.first << "\n";
         os << "Total size: " << item.second.total_size << " bytes\n";
         os << "Total memory objects: " << item.second.total_memory_objects << "\n";
+        os << "Total create time: " << item.second.total_create_time << " us\n";
+        const auto& create_time = item.second.create_time;
+        const size_t num_top_records = std::min<size_t>(create_time.size(), 10);
+        for (size_t i = 0; i < num_top_records; ++i) {
+            os << "    " << create_time[i].first << ": " << create_time[i].second << " us\n";
+        }
     }
 }
 
@@ -69,32 +79,49 @@ static void dumpStatisticsCSV(std::ofstream& os,
         for (auto&& stat : statistics) {
             os << "Memory control ID: " << stat.first << ";;;;;;\n";
             os << "Record name;Total regions [-];Total unique blocks [-];Total size [bytes];Optimal total size "
-                  "[bytes];Max region size [bytes]\n";
+                  "[bytes];Max region size [bytes];Total solves [-];Total reallocations [-];Total inferences [-]\n";
 
             for (auto&& item : stat.second) {
                 os << item.id << ";" << item.total_regions << ";" << item.total_unique_blocks << ";" << item.total_size
-                   << ";" << item.optimal_total_size << ";" << item.max_region_size << ";\n";
+                   << ";" << item.optimal_total_size << ";" << item.max_region_size << ";" << item.total_solves << ";"
+                   << item.total_reallocations << ";" << item.total_inferences << ";\n";
             }
         }
         os << ";;;;;;\n";
         os << "Scratchpad stats;;;;;;\n";
 
-        os << "Scratchpad ID;Size [bytes];;;;;\n";
+        os << "Scratchpad ID;Lane;Size [bytes];;;;\n";
 
-        const auto& scratchpads = ctx->getScratchPads();
-        for (size_t i = 0; i < scratchpads.size(); ++i) {
-            os << i << ";" << scratchpads[i]->size() << ";;;;;\n";
+        const auto& lanes = ctx->getScratchPads();
+        for (size_t lane = 0; lane < lanes.size(); ++lane) {
+            const auto& scratchpads = lanes[lane];
+            for (size_t i = 0; i < scratchpads.size(); ++i) {
+                os << i << ";" << lane << ";" << scratchpads[i]->size() << ";;;;\n";
+            }
         }
     }
     auto weights_statistics = weights_cache.dumpStatistics();
     if (!weights_statistics.empty()) {
         os << ";;;;;;\n";
         os << "Weights cache statistics;;;;;;\n";
-        os << "Socket ID;Total size [bytes];Total memory objects [-];;;\n";
+        os << "Socket ID;Total size [bytes];Total memory objects [-];Total create time [us];;\n";
     }
 
     for (auto&& item : weights_statistics) {
-        os << item.first << ";" << item.second.total_size << ";" << item.second.total_memory_objects << ";;;;;\n";
+        os << item.first << ";" << item.second.total_size << ";" << item.second.total_memory_objects << ";"
+           << item.second.total_create_time << ";;;;\n";
+    }
+
+    for (auto&& item : weights_statistics) {
+        if (item.second.create_time.empty()) {
+            continue;
+        }
+        os << ";;;;;;\n";
+        os << "Weights create time, socket " << item.first << ";;;;;;\n";
+        os << "Key;Create time [us];;;;;\n";
+        for (auto&& record : item.second.create_time) {
+            os << record.first << ";" << record.second << ";;;;;\n";
+        }
     }
 }
 
@@ -5,21 +5,47 @@
 #include "weights_cache.hpp"
 
 #include <atomic>
+#include <cstdint>
 #include <functional>
+#include <future>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <set>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 #ifdef CPU_DEBUG_CAPS
-#    include <vector>
+#    include <algorithm>
+#    include <chrono>
 #endif
 
 #include "cpu_memory.h"
+#include "memory_desc/cpu_memory_desc.h"
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/compute_hash.hpp"
 #include "openvino/runtime/system_conf.hpp"
+#include "utils/graph_serializer/repacked_weights.hpp"
 
 namespace ov::intel_cpu {
 
+namespace {
+
+// the same bytes of another type or shape are different weights, so the source desc is a part of the weights key
+std::string descKey(const IMemory& memory) {
+    const auto& desc = memory.getDesc();
+    return "_" + std::to_string(memory.getSize()) + "_" + desc.getPrecision().to_string() + "_" +
+           desc.getShape().toString() + "_" + desc.serializeFormat();
+}
+
+std::string offsetKey(uint64_t id, size_t offset, const IMemory& memory) {
+    return "o" + std::to_string(id) + "_" + std::to_string(offset) + descKey(memory);
+}
+
+}  // namespace
+
 WeightsSharing::SharedMemory::SharedMemory(std::unique_lock<std::mutex>&& lock,
                                            MemoryInfo::Ptr memory,
                                            MemoryPtr newPtr)
@@ -39,33 +65,97 @@ void WeightsSharing::SharedMemory::valid(bool b) {
     memory->valid.store(b, std::memory_order_release);
 }
 
+WeightsSharing::Shard& WeightsSharing::getShard(const std::string& key) {
+    return shards[std::hash<std::string>{}(key) % numShards];
+}
+
+const WeightsSharing::Shard& WeightsSharing::getShard(const std::string& key) const {
+    return shards[std::hash<std::string>{}(key) % numShards];
+}
+
 WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string& key,
                                                                const std::function<MemoryPtr(void)>& create,
                                                                bool valid) {
+    auto& shard = getShard(key);
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
-    {
-        std::unique_lock<std::mutex> lock(guard);
-        auto found = sharedWeights.find(key);
 
-        auto isCached = [&]() -> bool {
-            if (found == sharedWeights.end()) {
-                return false;
+    auto isCached = [&]() -> bool {
+        auto found = shard.sharedWeights.find(key);
+        if (found == shard.sharedWeights.end()) {
+            return false;
+        }
+        ptr = found->second;
+        if (!ptr) {
+            return false;
+        }
+        newPtr = ptr->sharedMemory.lock();
+        return static_cast<bool>(newPtr);
+    };
+
+    while (true) {
+        {
+            std::shared_lock<std::shared_mutex> lock(shard.guard);
+            if (isCached()) {
+                break;
             }
-            ptr = found->second;
-            if (!ptr) {
-                return false;
+        }
+
+        std::promise<void> created;
+        {
+            std::unique_lock<std::shared_mutex> lock(shard.guard);
+            if (isCached()) {
+                break;
             }
-            newPtr = ptr->sharedMemory.lock();
-            return static_cast<bool>(newPtr);
+            auto pending = shard.pending.find(key);
+            if (pending != shard.pending.end()) {
+                auto future = pending->second;
+                lock.unlock();
+                // the object is being created by another thread, so wait and look it up again
+                future.wait();
+                continue;
+            }
+            shard.pending.emplace(key, created.get_future().share());
+        }
+
+        // the object is created outside of the lock, so the other objects can be created concurrently
+        auto finishCreation = [&](const MemoryInfo::Ptr& info) {
+            {
+                std::unique_lock<std::shared_mutex> lock(shard.guard);
+                if (info) {
+                    shard.sharedWeights[key] = info;
+                }
+                shard.pending.erase(key);
+            }
+            created.set_value();
         };
 
-        if (!isCached()) {
+        try {
+#ifdef CPU_DEBUG_CAPS
+            const auto start = std::chrono::steady_clock::now();
+#endif  // CPU_DEBUG_CAPS
             newPtr = create();
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
-            sharedWeights[key] = ptr;
+#ifdef CPU_DEBUG_CAPS
+            ptr->createTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                                    start)
+                                  .count();
+#endif  // CPU_DEBUG_CAPS
+        } catch (...) {
+            finishCreation(nullptr);
+            throw;
         }
+
+        if (valid) {
+            finishCreation(ptr);
+            break;
+        }
+        // the invalid object must be locked before it is published, so nobody uses it until it's validated
+        std::unique_lock<std::mutex> objectLock(ptr->guard);
+        finishCreation(ptr);
+        return std::make_shared<SharedMemory>(std::move(objectLock), ptr, newPtr);
     }
+
     return std::make_shared<SharedMemory>(ptr->valid.load(std::memory_order_relaxed)
                                               ? std::unique_lock<std::mutex>(ptr->guard, std::defer_lock)
                                               : std::unique_lock<std::mutex>(ptr->guard),
@@ -74,13 +164,14 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string
 }
 
 WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) const {
+    const auto& shard = getShard(key);
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
     {
-        std::unique_lock<std::mutex> lock(guard);
-        auto found = sharedWeights.find(key);
+        std::shared_lock<std::shared_mutex> lock(shard.guard);
+        auto found = shard.sharedWeights.find(key);
 
-        OPENVINO_ASSERT(found != sharedWeights.end(), "Unknown shared memory with key ", key);
+        OPENVINO_ASSERT(found != shard.sharedWeights.end(), "Unknown shared memory with key ", key);
         ptr = found->second;
         OPENVINO_ASSERT(ptr, "Unknown shared memory with key ", key);
         newPtr = ptr->sharedMemory.lock();
@@ -93,10 +184,123 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                           newPtr);
 }
 
-SocketsWeights::SocketsWeights() {
+WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreateShared(const std::string& key,
+                                                                     const std::function<MemoryPtr(void)>& create) {
+    {
+        std::lock_guard<std::mutex> lock(m_sharedKeysGuard);
+        m_sharedKeys.insert(key);
+    }
+    return m_processWide ? m_processWide->findOrCreate(key, create) : findOrCreate(key, create);
+}
+
+std::string WeightsSharing::weightsKey(const MemoryCPtr& memory) {
+    const void* data = memory->getData();
+    {
+        std::lock_guard<std::mutex> lock(m_weightsKeysGuard);
+        auto found = m_weightsKeys.find(data);
+        // the address may be reused by another memory object, so the key is valid while the memory object is alive
+        if (found != m_weightsKeys.end() && found->second.first.lock() == memory) {
+            return found->second.second;
+        }
+    }
+
+    // the data is hashed without the lock, so the streams preparing different weights don't wait for each other
+    std::string key;
+    if (m_weightsOffsets && m_weightsOffsets->count(data) != 0) {
+        key = offsetKey(m_weightsId, m_weightsOffsets->at(data), *memory);
+    } else if (m_processWide) {
+        key = "c" + std::to_string(ov::runtime::compute_hash(data, memory->getSize())) + descKey(*memory);
+    } else {
+        // the address is replaced with the offset of the data on export (see sharedObjects()), if the offset is known
+        key = std::to_string(reinterpret_cast<uint64_t>(data));
+    }
+
+    std::lock_guard<std::mutex> lock(m_weightsKeysGuard);
+    m_weightsKeys[data] = {memory, key};
+    return key;
+}
+
+void WeightsSharing::setWeightsOffsets(uint64_t id, std::shared_ptr<const ConstantOffsets> offsets) {
+    m_weightsId = id;
+    m_weightsOffsets = std::move(offsets);
+}
+
+std::vector<std::pair<std::string, MemoryPtr>> WeightsSharing::sharedObjects() {
+    std::set<std::string> keys;
+    {
+        std::lock_guard<std::mutex> lock(m_sharedKeysGuard);
+        keys = m_sharedKeys;
+    }
+
+    const auto& cache = m_processWide ? *m_processWide : *this;
+    std::vector<std::pair<std::string, MemoryPtr>> objects;
+    for (const auto& key : keys) {
+        const auto& shard = cache.getShard(key);
+        std::shared_lock<std::shared_mutex> lock(shard.guard);
+        auto found = shard.sharedWeights.find(key);
+        if (found == shard.sharedWeights.end() || !found->second || !found->second->valid) {
+            continue;
+        }
+        if (auto memory = found->second->sharedMemory.lock()) {
+            objects.emplace_back(key, std::move(memory));
+        }
+    }
+    return objects;
+}
+
+std::vector<std::pair<std::string, MemoryPtr>> WeightsSharing::sharedObjects(uint64_t id,
+                                                                         const ConstantOffsets& offsets) {
+    // weights key -> the one based on the offset
+    std::unordered_map<std::string, std::string> offsetKeys;
+    {
+        std::lock_guard<std::mutex> lock(m_weightsKeysGuard);
+        for (const auto& [data, entry] : m_weightsKeys) {
+            const auto offset = offsets.find(data);
+            const auto memory = entry.first.lock();
+            if (offset != offsets.end() && memory) {
+                offsetKeys.emplace(entry.second, offsetKey(id, offset->second, *memory));
+            }
+        }
+    }
+
+    auto objects = sharedObjects();
+    for (auto& object : objects) {
+        // the weights key is the suffix of the object key (see findOrCreateShared())
+        auto& key = object.first;
+        for (auto pos = key.find('_'); pos != std::string::npos; pos = key.find('_', pos + 1)) {
+            const auto found = offsetKeys.find(key.substr(pos + 1));
+            if (found != offsetKeys.end()) {
+                key = key.substr(0, pos + 1) + found->second;
+                break;
+            }
+        }
+    }
+    return objects;
+}
+
+namespace {
+
+WeightsSharing::Ptr processWideWeightsCache(int socket_id) {
+    static std::mutex mutex;
+    // the registry doesn't own the caches, so a cache is released with the last compiled model using it
+    static std::map<int, std::weak_ptr<WeightsSharing>> caches;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto cache = caches[socket_id].lock();
+    if (!cache) {
+        cache = std::make_shared<WeightsSharing>();
+        caches[socket_id] = cache;
+    }
+    return cache;
+}
+
+}  // namespace
+
+SocketsWeights::SocketsWeights(bool processWide) {
     int num_sockets = get_num_sockets();
     for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
-        _cache_map[socket_id] = std::make_shared<WeightsSharing>();
+        _cache_map[socket_id] =
+            std::make_shared<WeightsSharing>(processWide ? processWideWeightsCache(socket_id) : nullptr);
     }
 }
 
@@ -114,18 +318,26 @@ const WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) const {
 
 #ifdef CPU_DEBUG_CAPS
 WeightsSharing::Statistics WeightsSharing::dumpStatistics() const {
-    Statistics retVal = {0, 0};
+    Statistics retVal = {0, 0, 0, {}};
 
-    std::lock_guard<std::mutex> lock(guard);
+    for (const auto& shard : shards) {
+        std::shared_lock<std::shared_mutex> lock(shard.guard);
 
-    for (const auto& item : sharedWeights) {
-        auto memory = item.second->sharedMemory.lock();
-        if (memory) {
-            retVal.total_size += memory->getDesc().getCurrentMemSize();
-            retVal.total_memory_objects++;
+        for (const auto& item : shard.sharedWeights) {
+            auto memory = item.second->sharedMemory.lock();
+            if (memory) {
+                retVal.total_size += memory->getDesc().getCurrentMemSize();
+                retVal.total_memory_objects++;
+                retVal.total_create_time += item.second->createTime;
+                retVal.create_time.emplace_back(item.first, item.second->createTime);
+            }
         }
     }
 
+    std::sort(retVal.create_time.begin(), retVal.create_time.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second > rhs.second;
+    });
+
     return retVal;
 }
 
@@ -4,18 +4,24 @@
 
 #pragma once
 
+#include <array>
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "cpu_memory.h"
+#include "utils/graph_serializer/repacked_weights.hpp"
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -28,7 +34,10 @@ namespace ov::intel_cpu {
  * Caching store of Memory objects
  * Will return a cached object or create new one
  *
- * Is a thread safe
+ * Is a thread safe. The records are distributed over a number of shards guarded by the read-write locks, so the
+ * lookups of the cached objects don't block each other. The objects are created outside of the locks, so distinct
+ * objects (e.g. the repacked weights requested by the parallel streams) are created concurrently, while the concurrent
+ * requests of the object being created wait for its creation.
  */
 class WeightsSharing {
     struct MemoryInfo {
@@ -39,6 +48,9 @@ class WeightsSharing {
         std::mutex guard;
         std::weak_ptr<IMemory> sharedMemory;
         std::atomic<bool> valid;
+#ifdef CPU_DEBUG_CAPS
+        uint64_t createTime = 0;  // microseconds
+#endif  // CPU_DEBUG_CAPS
     };
 
 public:
@@ -46,11 +58,19 @@ public:
     struct Statistics {
         size_t total_size;  // bytes
         size_t total_memory_objects;
+        uint64_t total_create_time;                                // microseconds
+        std::vector<std::pair<std::string, uint64_t>> create_time;  // per object, the most expensive go first
     };
 #endif  // CPU_DEBUG_CAPS
 
     using Ptr = std::shared_ptr<WeightsSharing>;
 
+    WeightsSharing() = default;
+    /**
+     * @param processWide is the process wide cache the objects derived from the weights are shared through
+     */
+    explicit WeightsSharing(Ptr processWide) : m_processWide(std::move(processWide)) {}
+
     class SharedMemory {
     public:
         using Ptr = std::shared_ptr<SharedMemory>;
@@ -73,13 +93,69 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * @brief Same as findOrCreate(), but intended for the objects derived from the weights only (e.g. the repacked
+     * weights), which keys are built on top of weightsKey(). If the cache is backed by the process wide one, the
+     * objects are shared with all the compiled models of the process using the same weights.
+     */
+    SharedMemory::Ptr findOrCreateShared(const std::string& key, const std::function<MemoryPtr(void)>& create);
+
+    /**
+     * @brief Returns the key identifying the weights data. If the cache is backed by the process wide one, the key is
+     * based on the content of the weights (and computed once per memory object), otherwise on the data address, which
+     * is mapped to the offset of the data only on export (see sharedObjects()). The weights of the imported model (see
+     * setWeightsOffsets()) are identified by the offsets of their data instead.
+     */
+    std::string weightsKey(const MemoryCPtr& memory);
+
+    /**
+     * @brief Makes weightsKey() identify the weights at the given data addresses by the offsets of their data in the
+     * serialized model, so the weights of the imported model are not hashed. The offsets are qualified by the id of
+     * the repacked weights section, so the keys of different blobs don't collide in the process wide cache.
+     */
+    void setWeightsOffsets(uint64_t id, std::shared_ptr<const ConstantOffsets> offsets);
+
+    /**
+     * @brief Returns the alive objects created (or found) through findOrCreateShared() of this cache along with their
+     * keys, e.g. to store the repacked weights in the compiled model blob
+     */
+    std::vector<std::pair<std::string, MemoryPtr>> sharedObjects();
+
+    /**
+     * @brief Same as above, but the weights keys the object keys are built on are replaced with the ones based on the
+     * given offsets of the weights data in the serialized model and the section id (see setWeightsOffsets()). The keys
+     * of the objects derived from the weights with unknown offsets are kept.
+     */
+    std::vector<std::pair<std::string, MemoryPtr>> sharedObjects(uint64_t id, const ConstantOffsets& offsets);
+
 #ifdef CPU_DEBUG_CAPS
     Statistics dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
 
 protected:
-    mutable std::mutex guard;
-    std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    struct Shard {
+        mutable std::shared_mutex guard;
+        std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+        // the objects being created at the moment
+        std::unordered_map<std::string, std::shared_future<void>> pending;
+    };
+
+    static constexpr size_t numShards = 16;
+
+    Shard& getShard(const std::string& key);
+    [[nodiscard]] const Shard& getShard(const std::string& key) const;
+
+    std::array<Shard, numShards> shards;
+
+private:
+    Ptr m_processWide;
+    std::mutex m_sharedKeysGuard;
+    std::set<std::string> m_sharedKeys;
+    std::mutex m_weightsKeysGuard;
+    // data address -> memory object and its key
+    std::unordered_map<const void*, std::pair<std::weak_ptr<const IMemory>, std::string>> m_weightsKeys;
+    uint64_t m_weightsId = 0;
+    std::shared_ptr<const ConstantOffsets> m_weightsOffsets;
 };
 
 /**
@@ -89,7 +165,11 @@ protected:
  */
 class SocketsWeights {
 public:
-    SocketsWeights();
+    /**
+     * @param processWide defines whether the caches are backed by the process wide ones, so the repacked weights are
+     * shared with the other compiled models of the process
+     */
+    explicit SocketsWeights(bool processWide = false);
 
     WeightsSharing::Ptr& operator[](int socket_id);
     const WeightsSharing::Ptr& operator[](int socket_id) const;
@@ -0,0 +1,156 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/test_assertions.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "openvino/op/assign.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/scaled_dot_product_attention.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace ov {
+namespace test {
+
+/*This test runs the following stateful subgraph, the KV cache states of which are held by the SDPA node:
+
+     ReadValue   Parameter      ReadValue   Parameter
+         |           |              |           |
+       Gather       /             Gather       /
+          \        /                 \        /
+           Concat     Parameter       Concat
+           /    \         |           /     \
+       Assign    ScaledDotProductAttention   Assign
+                              |
+                           Output
+
+  The requests operating on the states (fork, trim) must produce the same outputs as the requests inferring the same
+  tokens from the beginning.
+*/
+
+class KVCacheStatesTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const ov::PartialShape shape{-1, heads, -1, headSize};
+        ov::ParameterVector params;
+        for (size_t i = 0; i < 3; i++) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape));
+        }
+        params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1}));
+
+        ov::OutputVector kv;
+        ov::SinkVector sinks;
+        for (const auto* name : {"pastk", "pastv"}) {
+            auto variable =
+                std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, ov::element::f32, name});
+            auto past = std::make_shared<ov::op::v6::ReadValue>(variable);
+            auto gather = std::make_shared<ov::op::v8::Gather>(past,
+                                                               params[3],
+                                                               ov::op::v0::Constant::create(ov::element::i32, {}, {0}));
+            auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{gather, params[kv.size() + 1]}, 2);
+            sinks.push_back(std::make_shared<ov::op::v6::Assign>(concat, variable));
+            kv.push_back(concat);
+        }
+        auto sdpa = std::make_shared<ov::op::v13::ScaledDotProductAttention>(params[0], kv[0], kv[1], false);
+        auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(sdpa)},
+                                                 sinks,
+                                                 params,
+                                                 "KVCacheStates");
+        compiledModel = core.compile_model(model, ov::test::utils::DEVICE_CPU);
+    }
+
+    // infers the tokens [begin, end) of the sequence, the data of a token depends on the sequence and its position only
+    static void infer(ov::InferRequest& request, size_t sequence, size_t begin, size_t end) {
+        for (size_t input = 0; input < 3; input++) {
+            ov::Tensor tensor(ov::element::f32, ov::Shape{1, heads, end - begin, headSize});
+            auto* data = tensor.data<float>();
+            for (size_t h = 0; h < heads; h++) {
+                for (size_t t = begin; t < end; t++) {
+                    for (size_t s = 0; s < headSize; s++) {
+                        const auto seed = (((sequence * 3 + input) * heads + h) * 1000 + t) * headSize + s;
+                        *data++ = std::sin(0.1F * static_cast<float>(seed));
+                    }
+                }
+            }
+            request.set_input_tensor(input, tensor);
+        }
+        ov::Tensor beamIdx(ov::element::i32, ov::Shape{1});
+        beamIdx.data<int32_t>()[0] = 0;
+        request.set_input_tensor(3, beamIdx);
+        request.infer();
+    }
+
+    static constexpr size_t heads = 2;
+    static constexpr size_t headSize = 16;
+    ov::Core core;
+    ov::CompiledModel compiledModel;
+};
+
+TEST_F(KVCacheStatesTest, smoke_ForkContinuesFromPrefix) {
+    auto source = compiledModel.create_infer_request();
+    infer(source, 0, 0, 8);
+
+    auto fork = compiledModel.create_infer_request();
+    fork.fork_states(source, 6);
+
+    auto sourceReference = compiledModel.create_infer_request();
+    auto forkReference = compiledModel.create_infer_request();
+    infer(sourceReference, 0, 0, 8);
+    infer(forkReference, 0, 0, 6);
+
+    // the fork continues with other tokens than the source, which keeps appending to the shared memory
+    constexpr size_t steps = 3;
+    for (size_t i = 0; i < steps; i++) {
+        infer(fork, 1, 6 + i, 7 + i);
+        infer(forkReference, 1, 6 + i, 7 + i);
+        ov::test::utils::compare(forkReference.get_output_tensor(), fork.get_output_tensor(), 1e-5, 1e-5);
+
+        infer(source, 0, 8 + i, 9 + i);
+        infer(sourceReference, 0, 8 + i, 9 + i);
+        ov::test::utils::compare(sourceReference.get_output_tensor(), source.get_output_tensor(), 1e-5, 1e-5);
+    }
+
+    // the source rewriting the shared tokens leaves the fork intact
+    source.reset_state();
+    infer(source, 2, 0, 4);
+    infer(fork, 1, 9, 10);
+    infer(forkReference, 1, 9, 10);
+    ov::test::utils::compare(forkReference.get_output_tensor(), fork.get_output_tensor(), 1e-5, 1e-5);
+}
+
+TEST_F(KVCacheStatesTest, smoke_TrimContinuesAfterVerification) {
+    auto request = compiledModel.create_infer_request();
+    infer(request, 0, 0, 8);
+    // the verification of 3 draft tokens accepts the first one only
+    infer(request, 0, 8, 11);
+    request.trim_states(9);
+
+    auto reference = compiledModel.create_infer_request();
+    infer(reference, 0, 0, 9);
+
+    constexpr size_t steps = 3;
+    for (size_t i = 0; i < steps; i++) {
+        infer(request, 1, 9 + i, 10 + i);
+        infer(reference, 1, 9 + i, 10 + i);
+        ov::test::utils::compare(reference.get_output_tensor(), request.get_output_tensor(), 1e-5, 1e-5);
+    }
+
+    OV_EXPECT_THROW(request.trim_states(20), ov::Exception, testing::HasSubstr("Cannot truncate"));
+}
+
+}  // namespace test
+}  // namespace ov
@@ -2,16 +2,31 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "common_test_utils/node_builders/convolution.hpp"
 #include "common_test_utils/node_builders/eltwise.hpp"
 #include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/test_assertions.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
 #include "utils/cpu_test_utils.hpp"
 #include "openvino/op/add.hpp"
+#include "openvino/op/assign.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/result.hpp"
 #include "openvino/op/transpose.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/properties.hpp"
 
 namespace ov {
 namespace test {
@@ -314,5 +329,141 @@ INSTANTIATE_TEST_SUITE_P(smoke_Snippets_LoRA_CPU_Conv, LoraPatternConvolutionCPU
                                  ::testing::ValuesIn(states_policies)),
                          LoraPatternBaseCPUTest::getTestCaseName);
 
+/*This test runs the LoRA MatMul pattern with two adapters of different ranks stacked in the states and selected per
+  batch element through the lora_adapter_ids and lora_rank_offsets inputs. Each batch element must get the output of
+  the model with its adapter only, the base model for the negative id. The model with the LoRA matrix B multiplied as
+  not transposed can't select the adapters per batch element, so it must be rejected by the compilation.
+*/
+class LoraMultiAdapterCPUTest : public testing::Test {
+protected:
+    void SetUp() override {
+        compiledModel = core.compile_model(makeModel(true),
+                                           ov::test::utils::DEVICE_CPU,
+                                           ov::hint::inference_precision(ov::element::f32));
+    }
+
+    static std::shared_ptr<ov::Model> makeModel(bool transposedB) {
+        auto param_x = std::make_shared<ov::op::v0::Parameter>(netType, ov::PartialShape{-1, -1, K});
+        auto weights = ov::test::utils::create_and_fill_tensor(netType, ov::Shape{N, K});
+        auto main = std::make_shared<ov::op::v0::MatMul>(param_x,
+                                                         std::make_shared<ov::op::v0::Constant>(weights),
+                                                         false,
+                                                         true);
+
+        ov::OutputVector states;
+        ov::SinkVector assigns;
+        const ov::PartialShape bShape = transposedB ? ov::PartialShape{N, -1} : ov::PartialShape{-1, N};
+        for (const auto& [shape, name] : std::vector<std::pair<ov::PartialShape, std::string>>{{bShape, t4_name},
+                                                                                               {{1, -1}, t5_name},
+                                                                                               {{-1, K}, t6_name}}) {
+            auto variable =
+                std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, netType, name});
+            auto read_value = std::make_shared<ov::op::v6::ReadValue>(variable);
+            assigns.push_back(std::make_shared<ov::op::v6::Assign>(read_value, variable));
+            states.push_back(read_value);
+        }
+        auto xa = std::make_shared<ov::op::v0::MatMul>(param_x, states[2], false, true);
+        auto scaled = std::make_shared<ov::op::v1::Multiply>(xa, states[1]);
+        auto xab = std::make_shared<ov::op::v0::MatMul>(scaled, states[0], false, transposedB);
+        auto lora = std::make_shared<ov::op::v1::Add>(main, xab);
+
+        auto param_ids = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+        param_ids->get_output_tensor(0).set_names({"lora_adapter_ids"});
+        auto param_offsets = std::make_shared<ov::op::v0::Parameter>(ov::element::i32, ov::PartialShape{-1});
+        param_offsets->get_output_tensor(0).set_names({"lora_rank_offsets"});
+
+        return std::make_shared<ov::Model>(
+            ov::ResultVector{std::make_shared<ov::op::v0::Result>(main), std::make_shared<ov::op::v0::Result>(lora)},
+            assigns,
+            ov::ParameterVector{param_x, param_ids, param_offsets});
+    }
+
+    // the states of the adapters [begin, end) of the stacked ones
+    void setStates(ov::InferRequest& request, size_t begin, size_t end) const {
+        const size_t rank = end - begin;
+        ov::Tensor a(netType, ov::Shape{rank, K});
+        ov::Tensor alpha(netType, ov::Shape{1, rank});
+        ov::Tensor b(netType, ov::Shape{N, rank});
+        for (size_t r = 0; r < rank; r++) {
+            std::copy_n(stackedA.data<float>() + (begin + r) * K, K, a.data<float>() + r * K);
+            alpha.data<float>()[r] = stackedAlpha.data<float>()[begin + r];
+            for (size_t n = 0; n < N; n++) {
+                b.data<float>()[n * rank + r] = stackedB.data<float>()[n * totalRank + begin + r];
+            }
+        }
+        for (auto&& state : request.query_state()) {
+            const auto& name = state.get_name();
+            state.set_state(name == t6_name ? a : name == t5_name ? alpha : b);
+        }
+    }
+
+    static void selectAdapters(ov::InferRequest& request,
+                               const std::vector<int32_t>& ids,
+                               const std::vector<int32_t>& offsets) {
+        ov::Tensor idsTensor(ov::element::i32, ov::Shape{ids.size()});
+        ov::Tensor offsetsTensor(ov::element::i32, ov::Shape{offsets.size()});
+        std::copy(ids.begin(), ids.end(), idsTensor.data<int32_t>());
+        std::copy(offsets.begin(), offsets.end(), offsetsTensor.data<int32_t>());
+        request.set_tensor("lora_adapter_ids", idsTensor);
+        request.set_tensor("lora_rank_offsets", offsetsTensor);
+    }
+
+    // the rows of the batch element of the output
+    static ov::Tensor batchElement(const ov::Tensor& output, size_t i) {
+        const auto& shape = output.get_shape();
+        const size_t size = shape[1] * shape[2];
+        return {output.get_element_type(), {1, shape[1], shape[2]}, output.data<float>() + i * size};
+    }
+
+    static constexpr size_t K = 64LU;
+    static constexpr size_t N = 96LU;
+    static constexpr size_t rows = 3LU;
+    // the ranks of the adapters are 4 and 12
+    const std::vector<int32_t> rankOffsets{0, 4, 16};
+    static constexpr size_t totalRank = 16LU;
+
+    ov::Tensor stackedA = ov::test::utils::create_and_fill_tensor(netType, ov::Shape{totalRank, K});
+    ov::Tensor stackedAlpha = ov::test::utils::create_and_fill_tensor(netType, ov::Shape{1, totalRank});
+    ov::Tensor stackedB = ov::test::utils::create_and_fill_tensor(netType, ov::Shape{N, totalRank});
+    ov::Core core;
+    ov::CompiledModel compiledModel;
+};
+
+TEST_F(LoraMultiAdapterCPUTest, smoke_TwoAdaptersInOneBatch) {
+    // the rows of the first and the last batch elements are multiplied by the matrices of their adapter at once
+    const std::vector<int32_t> ids{1, -1, 0, 1};
+    const auto input = ov::test::utils::create_and_fill_tensor(netType, ov::Shape{ids.size(), rows, K});
+
+    auto request = compiledModel.create_infer_request();
+    setStates(request, 0, totalRank);
+    selectAdapters(request, ids, rankOffsets);
+    request.set_tensor(compiledModel.input(0), input);
+    request.infer();
+    const auto main = request.get_output_tensor(0);
+    const auto output = request.get_output_tensor(1);
+
+    for (size_t i = 0; i < ids.size(); i++) {
+        if (ids[i] < 0) {
+            ov::test::utils::compare(batchElement(main, i), batchElement(output, i), 1e-4, 1e-4);
+            continue;
+        }
+        // the single adapter mode with the states of the adapter only
+        auto reference = compiledModel.create_infer_request();
+        setStates(reference, rankOffsets[ids[i]], rankOffsets[ids[i] + 1]);
+        selectAdapters(reference, {}, {});
+        reference.set_tensor(compiledModel.input(0), batchElement(input, i));
+        reference.infer();
+        ov::test::utils::compare(reference.get_output_tensor(1), batchElement(output, i), 1e-4, 1e-4);
+    }
+}
+
+TEST_F(LoraMultiAdapterCPUTest, smoke_RejectsUnsupportedPattern) {
+    OV_EXPECT_THROW(core.compile_model(makeModel(false),
+                                       ov::test::utils::DEVICE_CPU,
+                                       ov::hint::inference_precision(ov::element::f32)),
+                    ov::Exception,
+                    testing::HasSubstr("supports multiple adapters only"));
+}
+
 }  // namespace test
 }  // namespace ov
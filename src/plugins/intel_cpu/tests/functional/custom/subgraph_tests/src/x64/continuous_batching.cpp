@@ -0,0 +1,239 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common_test_utils/test_assertions.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "openvino/op/assign.hpp"
+#include "openvino/op/broadcast.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/scaled_dot_product_attention.hpp"
+#include "openvino/op/shape_of.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/pass/sdpa_to_paged_attention.hpp"
+#include "openvino/runtime/continuous_batching_scheduler.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+namespace test {
+
+/*This test converts the following single layer language model by SDPAToPagedAttention and runs it with
+  ContinuousBatchingScheduler:
+
+                   input_ids
+                       |
+                   Embedding
+                 /     |     \
+            MatMul  MatMul  MatMul   ReadValue x 2
+               |       |      |          |
+               |       |      |      Gather x 2
+               |       |      |      /
+               |     Concat x 2 ----
+               |      /    \
+       ScaledDotProductAttention
+                   |
+                 MatMul
+                   |
+                 logits
+
+  The conversion leaves the type and the shape of the key_cache.0 / value_cache.0 inputs dynamic, the CPU plugin
+  sets them during the compilation. The tokens the scheduler generates for the batched requests must match the
+  greedy generation of the original stateful model.
+*/
+
+class ContinuousBatchingTest : public ::testing::Test {
+protected:
+    static std::shared_ptr<ov::op::v0::Constant> makeWeights(const ov::Shape& shape, size_t seed) {
+        std::vector<float> values(ov::shape_size(shape));
+        for (size_t i = 0; i < values.size(); i++) {
+            values[i] = 0.5F * std::sin(static_cast<float>(seed) + 0.37F * static_cast<float>(i));
+        }
+        return ov::op::v0::Constant::create(ov::element::f32, shape, values);
+    }
+
+    static std::shared_ptr<ov::Model> makeModel() {
+        auto makeParam = [](ov::element::Type type, const ov::PartialShape& shape, const std::string& name) {
+            auto param = std::make_shared<ov::op::v0::Parameter>(type, shape);
+            param->set_friendly_name(name);
+            param->output(0).set_names({name});
+            return param;
+        };
+        auto inputIds = makeParam(ov::element::i64, {-1, -1}, "input_ids");
+        auto positionIds = makeParam(ov::element::i64, {-1, -1}, "position_ids");
+        auto beamIdx = makeParam(ov::element::i32, {-1}, "beam_idx");
+
+        auto axis0 = ov::op::v0::Constant::create(ov::element::i64, {}, {0});
+        auto embeddings =
+            std::make_shared<ov::op::v8::Gather>(makeWeights({vocabSize, hiddenSize}, 0), inputIds, axis0);
+        auto batch = std::make_shared<ov::op::v8::Gather>(std::make_shared<ov::op::v3::ShapeOf>(positionIds),
+                                                          ov::op::v0::Constant::create(ov::element::i64, {1}, {0}),
+                                                          axis0);
+        auto toHeads =
+            ov::op::v0::Constant::create(ov::element::i64, {4}, std::vector<size_t>{0, 0, heads, headSize});
+        auto order = ov::op::v0::Constant::create(ov::element::i64, {4}, {0, 2, 1, 3});
+        auto project = [&](size_t seed) {
+            auto matmul = std::make_shared<ov::op::v0::MatMul>(embeddings,
+                                                               makeWeights({hiddenSize, hiddenSize}, seed),
+                                                               false,
+                                                               true);
+            auto reshape = std::make_shared<ov::op::v1::Reshape>(matmul, toHeads, true);
+            return std::make_shared<ov::op::v1::Transpose>(reshape, order);
+        };
+
+        ov::OutputVector kv;
+        ov::SinkVector sinks;
+        for (const auto* name : {"past_key_values.0.key", "past_key_values.0.value"}) {
+            const ov::PartialShape shape{-1, heads, -1, headSize};
+            auto variable =
+                std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, ov::element::f32, name});
+            auto emptyShape =
+                ov::op::v0::Constant::create(ov::element::i64, {3}, std::vector<size_t>{heads, 0, headSize});
+            auto initShape = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{batch, emptyShape}, 0);
+            auto init = std::make_shared<ov::op::v3::Broadcast>(
+                ov::op::v0::Constant::create(ov::element::f32, {}, {0.F}),
+                initShape);
+            auto past = std::make_shared<ov::op::v8::Gather>(std::make_shared<ov::op::v6::ReadValue>(init, variable),
+                                                             beamIdx,
+                                                             axis0);
+            auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{past, project(kv.size() + 2)}, 2);
+            sinks.push_back(std::make_shared<ov::op::v6::Assign>(concat, variable));
+            kv.push_back(concat);
+        }
+        // the reference infers a token at a time, so attending to all the cached tokens is causal
+        auto mask = ov::op::v0::Constant::create(ov::element::f32, {1, 1, 1, 1}, {0.F});
+        auto sdpa = std::make_shared<ov::op::v13::ScaledDotProductAttention>(project(1), kv[0], kv[1], mask, false);
+        auto hidden = std::make_shared<ov::op::v1::Reshape>(
+            std::make_shared<ov::op::v1::Transpose>(sdpa, order),
+            ov::op::v0::Constant::create(ov::element::i64, {3}, std::vector<size_t>{0, 0, hiddenSize}),
+            true);
+        auto logits =
+            std::make_shared<ov::op::v0::MatMul>(hidden, makeWeights({vocabSize, hiddenSize}, 4), false, true);
+        logits->output(0).set_names({"logits"});
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(logits)},
+                                           sinks,
+                                           ov::ParameterVector{inputIds, positionIds, beamIdx},
+                                           "ContinuousBatching");
+    }
+
+    static ov::CompiledModel compilePagedModel(ov::Core& core, ov::element::Type cachePrecision) {
+        auto model = makeModel();
+        ov::pass::Manager manager;
+        manager.register_pass<ov::pass::SDPAToPagedAttention>();
+        manager.run_passes(model);
+        return core.compile_model(model,
+                                  ov::test::utils::DEVICE_CPU,
+                                  ov::hint::inference_precision(ov::element::f32),
+                                  ov::hint::kv_cache_precision(cachePrecision));
+    }
+
+    // greedy generation of the stateful model, a token per inference
+    std::vector<int64_t> generate(const std::vector<int64_t>& prompt, size_t maxNewTokens) {
+        auto request = statefulModel.create_infer_request();
+        std::vector<int64_t> tokens = prompt;
+        std::vector<int64_t> generated;
+        ov::Tensor inputIds(ov::element::i64, {1, 1});
+        ov::Tensor positionIds(ov::element::i64, {1, 1});
+        ov::Tensor beamIdx(ov::element::i32, {1});
+        beamIdx.data<int32_t>()[0] = 0;
+        for (size_t i = 0; generated.size() < maxNewTokens; i++) {
+            inputIds.data<int64_t>()[0] = tokens[i];
+            positionIds.data<int64_t>()[0] = static_cast<int64_t>(i);
+            request.set_tensor("input_ids", inputIds);
+            request.set_tensor("position_ids", positionIds);
+            request.set_tensor("beam_idx", beamIdx);
+            request.infer();
+            if (i + 1 < tokens.size()) {
+                continue;
+            }
+            const auto logits = request.get_tensor("logits");
+            const auto* data = logits.data<float>();
+            tokens.push_back(static_cast<int64_t>(std::max_element(data, data + vocabSize) - data));
+            generated.push_back(tokens.back());
+        }
+        return generated;
+    }
+
+    void SetUp() override {
+        statefulModel = core.compile_model(makeModel(),
+                                           ov::test::utils::DEVICE_CPU,
+                                           ov::hint::inference_precision(ov::element::f32),
+                                           ov::hint::kv_cache_precision(ov::element::f32));
+    }
+
+    static constexpr size_t vocabSize = 64;
+    static constexpr size_t heads = 2;
+    static constexpr size_t headSize = 16;
+    static constexpr size_t hiddenSize = heads * headSize;
+    ov::Core core;
+    ov::CompiledModel statefulModel;
+};
+
+TEST_F(ContinuousBatchingTest, smoke_MatchesStatefulGeneration) {
+    auto compiledModel = compilePagedModel(core, ov::element::f32);
+    ov::ContinuousBatchingConfig config;
+    config.num_kv_blocks = 4;
+    // the longest prompt is split into chunks
+    config.max_num_batched_tokens = 16;
+    ov::ContinuousBatchingScheduler scheduler(compiledModel, config);
+
+    const std::vector<std::vector<int64_t>> prompts{{1, 2, 3}, {5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53}};
+    constexpr size_t maxNewTokens = 40;
+    std::map<uint64_t, size_t> prompt;
+    for (size_t i = 0; i < prompts.size(); i++) {
+        prompt[scheduler.add_request(prompts[i], maxNewTokens)] = i;
+    }
+    std::vector<std::vector<int64_t>> generated(prompts.size());
+    while (scheduler.has_unfinished_requests()) {
+        for (const auto& token : scheduler.step()) {
+            generated[prompt.at(token.request_id)].push_back(token.token);
+        }
+    }
+    ASSERT_EQ(scheduler.free_blocks(), config.num_kv_blocks);
+    for (size_t i = 0; i < prompts.size(); i++) {
+        ASSERT_EQ(generated[i], generate(prompts[i], maxNewTokens));
+    }
+}
+
+TEST_F(ContinuousBatchingTest, smoke_BlockSizeOfQuantizedCache) {
+    // the key cache quantized by channel keeps its scales along the block dimension
+    auto compiledModel = compilePagedModel(core, ov::element::u8);
+    ov::ContinuousBatchingConfig config;
+    config.num_kv_blocks = 2;
+    ov::ContinuousBatchingScheduler scheduler(compiledModel, config);
+
+    constexpr size_t blockSize = 32;
+    OV_EXPECT_THROW(scheduler.add_request(std::vector<int64_t>(2 * blockSize - 3, 1), 4),
+                    ov::Exception,
+                    testing::HasSubstr("doesn't fit"));
+    scheduler.add_request(std::vector<int64_t>(2 * blockSize - 4, 1), 4);
+    size_t generated = 0;
+    while (scheduler.has_unfinished_requests()) {
+        generated += scheduler.step().size();
+    }
+    ASSERT_EQ(generated, 4);
+    ASSERT_EQ(scheduler.free_blocks(), config.num_kv_blocks);
+}
+
+}  // namespace test
+}  // namespace ov
@@ -3,6 +3,7 @@
 //
 
 #include "custom/subgraph_tests/src/classes/moe.hpp"
+#include "internal_properties.hpp"
 
 using namespace CPUTestUtils;
 namespace ov {
@@ -44,6 +45,20 @@ INSTANTIATE_TEST_SUITE_P(smoke_MoESubgraph_basic,
                                             ::testing::ValuesIn(generate_additional_config())),
                          MoESubgraphTest::getTestCaseName);
 
+// all the experts executed as GEMMs and all token by token
+const std::vector<ov::AnyMap> grouped_gemm_configs = {
+    {{ov::intel_cpu::cpu_moe_grouped_gemm_min_tokens.name(), uint64_t{1}}},
+    {{ov::intel_cpu::cpu_moe_grouped_gemm_min_tokens.name(), uint64_t{0}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MoESubgraph_grouped_gemm,
+                         MoESubgraphTest,
+                         ::testing::Combine(::testing::ValuesIn(moe_params_smoke),
+                                            ::testing::Values(MoEType::MoE3GeMM),
+                                            ::testing::Values(MoEActivationType::SWISH),
+                                            ::testing::ValuesIn(grouped_gemm_configs)),
+                         MoESubgraphTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(smoke_MoESubgraph_3gemm_gelu,
                          MoESubgraphTest,
                          ::testing::Combine(::testing::ValuesIn(moe_params_smoke),
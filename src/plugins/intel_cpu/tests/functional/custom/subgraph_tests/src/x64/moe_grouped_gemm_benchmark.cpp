@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+#include "custom/subgraph_tests/src/classes/moe.hpp"
+#include "internal_properties.hpp"
+
+// Compares the MoE GatherMatmul nodes executing the tokens of an expert as one GEMM with the token by token execution
+// at different top-k and expert counts. Disabled by default, run with --gtest_also_run_disabled_tests.
+
+using namespace CPUTestUtils;
+namespace ov {
+namespace test {
+namespace {
+
+constexpr size_t warmup_iterations = 5;
+constexpr size_t iterations = 20;
+
+template <typename MoETest>
+class MoEGroupedGemmBenchmark : public MoETest {
+protected:
+    void run_benchmark() {
+        this->generate_inputs(this->targetStaticShapes.front());
+        for (const uint64_t min_tokens : {0, 4}) {
+            auto config = this->configuration;
+            config[ov::intel_cpu::cpu_moe_grouped_gemm_min_tokens.name()] = min_tokens;
+            auto compiled_model = this->core->compile_model(this->function, this->targetDevice, config);
+            auto request = compiled_model.create_infer_request();
+            for (const auto& [port, tensor] : this->inputs) {
+                request.set_tensor(port, tensor);
+            }
+            for (size_t i = 0; i < warmup_iterations; i++) {
+                request.infer();
+            }
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < iterations; i++) {
+                request.infer();
+            }
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            std::cout << (min_tokens == 0 ? "token by token: " : "grouped GEMM: ")
+                      << std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() / iterations
+                      << " us per inference" << std::endl;
+        }
+    }
+};
+
+using MoEGroupedGemmBenchmarkTest = MoEGroupedGemmBenchmark<MoESubgraphTest>;
+using MoECompressedGroupedGemmBenchmarkTest = MoEGroupedGemmBenchmark<MoECompressedWeightsSubgraphTest>;
+
+TEST_P(MoEGroupedGemmBenchmarkTest, DISABLED_GroupedGemmVsTokenByToken) {
+    run_benchmark();
+}
+
+TEST_P(MoECompressedGroupedGemmBenchmarkTest, DISABLED_GroupedGemmVsTokenByToken) {
+    run_benchmark();
+}
+
+// prefill of 1024 tokens
+const std::vector<MoeTestShapeParams> moe_params_prefill = {
+    {{{-1, -1, 1024}, {{1, 1024, 1024}}}, 2, 8, 1024},
+    {{{-1, -1, 1024}, {{1, 1024, 1024}}}, 8, 8, 1024},
+    {{{-1, -1, 1024}, {{1, 1024, 1024}}}, 2, 64, 1024},
+    {{{-1, -1, 1024}, {{1, 1024, 1024}}}, 8, 64, 1024},
+    {{{-1, -1, 1024}, {{1, 1024, 1024}}}, 4, 128, 1024},
+    {{{-1, -1, 1024}, {{1, 1024, 1024}}}, 8, 128, 1024},
+};
+
+INSTANTIATE_TEST_SUITE_P(MoEGroupedGemmBenchmark,
+                         MoEGroupedGemmBenchmarkTest,
+                         ::testing::Combine(::testing::ValuesIn(moe_params_prefill),
+                                            ::testing::Values(MoEType::MoE3GeMM),
+                                            ::testing::Values(MoEActivationType::SWISH),
+                                            ::testing::Values(ov::AnyMap{})),
+                         MoESubgraphTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(MoEGroupedGemmBenchmark,
+                         MoECompressedGroupedGemmBenchmarkTest,
+                         ::testing::Combine(::testing::ValuesIn(moe_params_prefill),
+                                            ::testing::Values(MoEType::MoE3GeMM),
+                                            ::testing::Values(MoEActivationType::SWISH),
+                                            ::testing::Values(ov::element::u4),
+                                            ::testing::Values(ov::element::f32),
+                                            ::testing::Values(ov::element::f32),
+                                            ::testing::Values(ov::test::utils::DecompressionType::full),
+                                            ::testing::Values(ov::test::utils::DecompressionType::full),
+                                            ::testing::Values(false),  // reshape on decompression
+                                            ::testing::Values(128),    // decompression group size
+                                            ::testing::Values(ov::AnyMap{}),
+                                            ::testing::Values(true)),  // use_matmul_decompression_impl
+                         MoECompressedWeightsSubgraphTest::getTestCaseName);
+
+}  // namespace
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common_test_utils/node_builders/convolution.hpp"
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/properties.hpp"
+
+namespace ov {
+namespace test {
+
+/*This test exports the following subgraph along with the repacked weights (CPU_CACHE_REPACKED_WEIGHTS):
+
+    Param
+      |
+  Convolution
+      |
+    Output
+
+  The imported model must take the repacked weights of the convolution from the blob instead of repacking the original
+  ones. To tell them apart, the original weights are zeroed in the blob before the import.
+*/
+
+class RepackedWeightsCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        weights.resize(channels * channels * 3 * 3);
+        for (size_t i = 0; i < weights.size(); i++) {
+            weights[i] = std::sin(0.1F * static_cast<float>(i));
+        }
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputShape);
+        auto conv = ov::test::utils::make_convolution(param,
+                                                      ov::element::f32,
+                                                      {3, 3},
+                                                      {1, 1},
+                                                      {1, 1},
+                                                      {1, 1},
+                                                      {1, 1},
+                                                      ov::op::PadType::EXPLICIT,
+                                                      channels,
+                                                      false,
+                                                      weights);
+        model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(conv)},
+                                            ov::ParameterVector{param},
+                                            "RepackedWeightsCache");
+    }
+
+    std::string exportModel(ov::CacheMode mode, bool cacheRepackedWeights) {
+        const ov::AnyMap config{{ov::intel_cpu::cpu_cache_repacked_weights.name(), cacheRepackedWeights},
+                                {ov::cache_mode.name(), mode}};
+        auto compiledModel = core.compile_model(model, ov::test::utils::DEVICE_CPU, config);
+        std::stringstream stream;
+        compiledModel.export_model(stream);
+        return stream.str();
+    }
+
+    static constexpr size_t channels = 16;
+    const ov::Shape inputShape{1, channels, 8, 8};
+    std::vector<float> weights;
+    ov::Core core;
+    std::shared_ptr<ov::Model> model;
+};
+
+TEST_F(RepackedWeightsCacheTest, smoke_ImportReusesRepackedWeights) {
+    const auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32,
+                                                               inputShape,
+                                                               ov::test::utils::InputGenerateData(-5, 10, 1000, 1));
+    auto reference = core.compile_model(model, ov::test::utils::DEVICE_CPU).create_infer_request();
+    reference.set_input_tensor(input);
+    reference.infer();
+
+    auto blob = exportModel(ov::CacheMode::OPTIMIZE_SPEED, true);
+    const std::string original(reinterpret_cast<const char*>(weights.data()), weights.size() * sizeof(float));
+    const auto pos = blob.find(original);
+    ASSERT_NE(pos, std::string::npos);
+    std::fill_n(blob.begin() + pos, original.size(), '\0');
+
+    std::stringstream stream(blob);
+    auto request = core.import_model(stream, ov::test::utils::DEVICE_CPU).create_infer_request();
+    request.set_input_tensor(input);
+    request.infer();
+    ov::test::utils::compare(reference.get_output_tensor(), request.get_output_tensor(), 1e-5, 1e-5);
+}
+
+TEST_F(RepackedWeightsCacheTest, smoke_OptimizeSizeSkipsRepackedWeights) {
+    ASSERT_GT(exportModel(ov::CacheMode::OPTIMIZE_SPEED, true).size(),
+              exportModel(ov::CacheMode::OPTIMIZE_SPEED, false).size());
+    ASSERT_EQ(exportModel(ov::CacheMode::OPTIMIZE_SIZE, true).size(),
+              exportModel(ov::CacheMode::OPTIMIZE_SIZE, false).size());
+}
+
+}  // namespace test
+}  // namespace ov
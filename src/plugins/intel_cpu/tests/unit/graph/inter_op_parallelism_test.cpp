@@ -0,0 +1,101 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "graph.h"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/softmax.hpp"
+
+using namespace ov::intel_cpu;
+
+/*
+ * Test the concurrent execution of the independent nodes of a static graph.
+ *
+ *              Parameter
+ *              /       \
+ *        SoftmaxA     SoftmaxB     <*NOTE: level 0*>
+ *            |           |
+ *        SoftmaxA2    SoftmaxB2    <*NOTE: level 1*>
+ *            |           |
+ *        SoftmaxA3    SoftmaxB3    <*NOTE: level 2*>
+ *            |           |
+ *          Result      Result
+ *
+ * Executed sequentially (A, B, A2, B2, A3, B3) the output of SoftmaxA could be reused for the output of SoftmaxB2,
+ * but SoftmaxA2 reads the former while SoftmaxB2 writes the latter concurrently. The branches are dispatched by their
+ * dependencies only, so a branch may run ahead of the other one by several levels.
+ */
+TEST(InterOpParallelismCPUTest, smoke_ConcurrentNodesDontShareMemory) {
+    Config conf;
+    conf.rtCacheCapacity = 100;
+    conf.interOpParallelism = 2;
+    auto context = std::make_shared<GraphContext>(conf, nullptr, false);
+
+    const ov::element::Type_t testPrec = ov::element::Type_t::f32;
+    auto param = std::make_shared<ov::op::v0::Parameter>(testPrec, ov::Shape{1, 3, 8, 8});
+    auto softmaxA = std::make_shared<ov::op::v1::Softmax>(param, 1);
+    softmaxA->set_friendly_name("SoftmaxA");
+    auto softmaxA2 = std::make_shared<ov::op::v1::Softmax>(softmaxA, 2);
+    softmaxA2->set_friendly_name("SoftmaxA2");
+    auto softmaxB = std::make_shared<ov::op::v1::Softmax>(param, 3);
+    softmaxB->set_friendly_name("SoftmaxB");
+    auto softmaxB2 = std::make_shared<ov::op::v1::Softmax>(softmaxB, 2);
+    softmaxB2->set_friendly_name("SoftmaxB2");
+    auto softmaxA3 = std::make_shared<ov::op::v1::Softmax>(softmaxA2, 3);
+    softmaxA3->set_friendly_name("SoftmaxA3");
+    auto softmaxB3 = std::make_shared<ov::op::v1::Softmax>(softmaxB2, 1);
+    softmaxB3->set_friendly_name("SoftmaxB3");
+
+    ov::ResultVector results{std::make_shared<ov::op::v0::Result>(softmaxA3),
+                             std::make_shared<ov::op::v0::Result>(softmaxB3)};
+    const auto model = std::make_shared<const ov::Model>(results, ov::ParameterVector{param}, "test_graph");
+
+    Graph graph;
+    graph.CreateGraph(model, context);
+
+    std::unordered_map<std::string, NodePtr> softmaxes;
+    for (const auto& node : graph.GetNodes()) {
+        if (node->getType() == Type::Softmax) {
+            softmaxes[node->getName()] = node;
+        }
+    }
+    ASSERT_EQ(softmaxes.size(), 6);
+
+    // the nodes of the same level are adjacent
+    for (const auto* first : {"SoftmaxA", "SoftmaxB"}) {
+        for (const auto* second : {"SoftmaxA2", "SoftmaxB2"}) {
+            ASSERT_LT(softmaxes[first]->getExecIndex(), softmaxes[second]->getExecIndex());
+        }
+    }
+
+    // the memory read by a node is not reused by a node executed concurrently
+    auto outputData = [&softmaxes](const std::string& name) {
+        return softmaxes[name]->getChildEdgeAt(0)->getMemory().getData();
+    };
+    ASSERT_NE(outputData("SoftmaxA"), outputData("SoftmaxB2"));
+    ASSERT_NE(outputData("SoftmaxB"), outputData("SoftmaxA2"));
+    ASSERT_NE(outputData("SoftmaxA"), outputData("SoftmaxB3"));
+    ASSERT_NE(outputData("SoftmaxB"), outputData("SoftmaxA3"));
+}
+
+TEST(InterOpParallelismCPUTest, smoke_ScratchPadLaneIsSelectedPerThread) {
+    Config conf;
+    conf.interOpParallelism = 2;
+    auto context = std::make_shared<GraphContext>(conf, nullptr, false);
+
+    const auto defaultScratchPad = context->getScratchPad();
+    {
+        GraphContext::ScratchPadLaneScope laneScope(1);
+        ASSERT_EQ(context->getScratchPad(), context->getScratchPad(0, 1));
+        ASSERT_NE(context->getScratchPad(), defaultScratchPad);
+        // another thread keeps the default lane
+        std::thread([&] {
+            ASSERT_EQ(context->getScratchPad(), defaultScratchPad);
+        }).join();
+    }
+    ASSERT_EQ(context->getScratchPad(), defaultScratchPad);
+}
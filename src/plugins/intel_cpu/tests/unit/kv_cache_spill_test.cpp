@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+#include "kv_cache_spill.hpp"
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/allocator.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+using namespace ov::intel_cpu;
+
+#if defined(__linux__)
+
+namespace {
+
+constexpr size_t blockBytes = 8192;
+
+void fillBlocks(ov::Tensor& tensor) {
+    auto* data = static_cast<uint8_t*>(tensor.data());
+    for (size_t block = 0; block < tensor.get_shape()[0]; block++) {
+        std::fill_n(data + block * blockBytes, blockBytes, static_cast<uint8_t>(block + 1));
+    }
+}
+
+void expectBlocks(const ov::Tensor& tensor) {
+    const auto* data = static_cast<const uint8_t*>(tensor.data());
+    for (size_t block = 0; block < tensor.get_shape()[0]; block++) {
+        for (size_t i = 0; i < blockBytes; i++) {
+            ASSERT_EQ(data[block * blockBytes + i], static_cast<uint8_t>(block + 1)) << "block " << block;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(KVCacheSpillAllocatorTest, BlocksAboveDramBudgetAreSpilled) {
+    const auto directory = std::filesystem::temp_directory_path().string();
+    ov::Tensor tensor(ov::element::u8,
+                      ov::Shape{8, blockBytes},
+                      ov::Allocator{KVCacheSpillAllocator(directory, 2 * blockBytes)});
+    fillBlocks(tensor);
+    expectBlocks(tensor);
+
+    const std::vector<int32_t> blocks{0, 1, 2, 7, -1, 100};
+    // only the valid blocks above the budget
+    ASSERT_EQ(KVCacheSpillAllocator::prefetch(tensor.data(), blockBytes, blocks.data(), blocks.size()), 2);
+
+    // the tensor grown by a block manager is reallocated by the same allocator
+    tensor.set_shape(ov::Shape{16, blockBytes});
+    fillBlocks(tensor);
+    expectBlocks(tensor);
+    ASSERT_EQ(KVCacheSpillAllocator::prefetch(tensor.data(), blockBytes, blocks.data(), blocks.size()), 2);
+}
+
+TEST(KVCacheSpillAllocatorTest, OtherMemoryIsNotPrefetched) {
+    ov::Tensor tensor(ov::element::u8, ov::Shape{4, blockBytes});
+    const std::vector<int32_t> blocks{0, 1, 2, 3};
+    ASSERT_EQ(KVCacheSpillAllocator::prefetch(tensor.data(), blockBytes, blocks.data(), blocks.size()), 0);
+
+    // the whole tensor fits into the budget
+    const auto directory = std::filesystem::temp_directory_path().string();
+    ov::Tensor dram(ov::element::u8,
+                    ov::Shape{4, blockBytes},
+                    ov::Allocator{KVCacheSpillAllocator(directory, 4 * blockBytes)});
+    ASSERT_EQ(KVCacheSpillAllocator::prefetch(dram.data(), blockBytes, blocks.data(), blocks.size()), 0);
+}
+
+TEST(KVCacheSpillAllocatorTest, ThrowsOnMissingDirectory) {
+    KVCacheSpillAllocator allocator("/nonexistent/kv_cache_spill", 0);
+    ASSERT_THROW(allocator.allocate(blockBytes), ov::Exception);
+}
+
+#endif
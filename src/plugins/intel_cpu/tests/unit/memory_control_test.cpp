@@ -0,0 +1,146 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "memory_control.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+MemoryRegion dynamicRegion(int start, int finish, int64_t id) {
+    return {start, finish, -1, id, MemoryRegion::RegionType::VARIABLE, MemoryRegion::AllocType::POD};
+}
+
+// the blocks may be wrapped individually (e.g. to collect statistics), so compare the underlying memory
+bool shareMemory(const MemoryBlockPtr& lhs, const MemoryBlockPtr& rhs) {
+    lhs->resize(64);
+    return lhs->getRawPtr() == rhs->getRawPtr();
+}
+
+}  // namespace
+
+TEST(MemoryControlTest, NonOverlappingRegionsShareBlock) {
+    NetworkMemoryControl networkControl;
+    auto control = networkControl.createMemoryControlUnit("test");
+
+    control->insert({dynamicRegion(0, 1, 0), dynamicRegion(1, 2, 1), dynamicRegion(2, 3, 2)}, {});
+    auto solution = control->solve();
+
+    ASSERT_EQ(solution.size(), 3);
+    // regions 0 and 2 don't overlap, region 1 overlaps with both of them
+    ASSERT_TRUE(shareMemory(solution.at(0), solution.at(2)));
+    ASSERT_FALSE(shareMemory(solution.at(0), solution.at(1)));
+}
+
+TEST(MemoryControlTest, RepeatedInsertKeepsSolvedBlocks) {
+    NetworkMemoryControl networkControl;
+    auto control = networkControl.createMemoryControlUnit("test");
+
+    control->insert({dynamicRegion(0, 1, 0), dynamicRegion(2, 3, 1)}, {});
+    auto first = control->solve();
+    ASSERT_TRUE(shareMemory(first.at(0), first.at(1)));
+
+    control->insert({dynamicRegion(1, 2, 2), dynamicRegion(4, -1, 3)}, {});
+    auto second = control->solve();
+
+    ASSERT_EQ(second.size(), 4);
+    ASSERT_EQ(second.at(0), first.at(0));
+    ASSERT_EQ(second.at(1), first.at(1));
+    // the new region overlapping both the solved ones gets a separate block
+    ASSERT_FALSE(shareMemory(second.at(0), second.at(2)));
+    // the new region not overlapping the solved ones reuses their block
+    ASSERT_TRUE(shareMemory(second.at(0), second.at(3)));
+}
+
+TEST(MemoryControlTest, GeometricGrowth) {
+    NetworkMemoryControl networkControl(2.0F);
+    auto control = networkControl.createMemoryControlUnit("test");
+
+    control->insert(MemoryRegions{dynamicRegion(0, 1, 0)}, {});
+    auto solution = control->solve();
+    control->allocateMemory();
+
+    auto block = solution.at(0);
+    ASSERT_TRUE(block->resize(100));
+    // the block is enlarged up to 200 bytes
+    ASSERT_TRUE(block->resize(101));
+    ASSERT_FALSE(block->resize(150));
+    ASSERT_FALSE(block->resize(200));
+    ASSERT_TRUE(block->resize(201));
+
+    // the first allocation after release is exact
+    control->releaseMemory();
+    ASSERT_TRUE(block->resize(10));
+    ASSERT_TRUE(block->resize(11));
+}
+
+TEST(MemoryControlTest, ExactGrowthByDefault) {
+    NetworkMemoryControl networkControl;
+    auto control = networkControl.createMemoryControlUnit("test");
+
+    control->insert(MemoryRegions{dynamicRegion(0, 1, 0)}, {});
+    auto block = control->solve().at(0);
+    control->allocateMemory();
+
+    ASSERT_TRUE(block->resize(100));
+    ASSERT_TRUE(block->resize(101));
+    ASSERT_FALSE(block->resize(101));
+    ASSERT_TRUE(block->resize(102));
+}
+
+TEST(MemoryControlTest, DynamicMemoryArena) {
+    NetworkMemoryControl networkControl(1.0F, 1024);
+    auto control = networkControl.createMemoryControlUnit("test");
+
+    control->insert({dynamicRegion(0, 2, 0), dynamicRegion(1, 3, 1)}, {});
+    auto solution = control->solve();
+    control->allocateMemory();
+    auto first = solution.at(0);
+    auto second = solution.at(1);
+
+    // the arena is empty at the first inference, so the blocks are allocated on the heap
+    ASSERT_TRUE(first->resize(100));
+    ASSERT_TRUE(second->resize(100));
+    control->finishInference();
+
+    // then the arena is sized to the high-water mark and the blocks are moved there one after another
+    auto* firstPtr = static_cast<uint8_t*>(first->getRawPtr());
+    auto* secondPtr = static_cast<uint8_t*>(second->getRawPtr());
+    ASSERT_NE(firstPtr, nullptr);
+    ASSERT_EQ(secondPtr - firstPtr, 128);
+
+    // the steady state inference doesn't touch the memory
+    ASSERT_FALSE(first->resize(100));
+    ASSERT_FALSE(second->resize(64));
+    control->finishInference();
+    ASSERT_EQ(first->getRawPtr(), firstPtr);
+    ASSERT_EQ(second->getRawPtr(), secondPtr);
+
+    // the demand above the limit is served by the heap, the arena grows up to the limit
+    ASSERT_TRUE(first->resize(2048));
+    auto* heapPtr = first->getRawPtr();
+    control->finishInference();
+    ASSERT_EQ(first->getRawPtr(), heapPtr);
+    secondPtr = static_cast<uint8_t*>(second->getRawPtr());
+    ASSERT_NE(secondPtr, nullptr);
+
+    // nothing has been reallocated, so nothing is moved
+    control->finishInference();
+    ASSERT_EQ(first->getRawPtr(), heapPtr);
+    ASSERT_EQ(second->getRawPtr(), secondPtr);
+
+    // the arena at its limit is still rearranged after the inferences, so the regrown blocks get back there
+    ASSERT_TRUE(second->resize(512));
+    control->finishInference();
+    ASSERT_EQ(second->getRawPtr(), secondPtr);
+    ASSERT_TRUE(second->resize(1000));
+    ASSERT_NE(second->getRawPtr(), secondPtr);
+    control->finishInference();
+    ASSERT_EQ(second->getRawPtr(), secondPtr);
+    ASSERT_EQ(first->getRawPtr(), heapPtr);
+}
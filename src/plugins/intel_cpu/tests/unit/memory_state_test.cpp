@@ -0,0 +1,183 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <numeric>
+
+#include "cpu_memory.h"
+#include "cpu_tensor.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "memory_state.h"
+#include "nodes/common/arbitrary_order_desc_creator.h"
+#include "openvino/core/except.hpp"
+#include "openvino/core/partial_shape.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+// [B, H, L, S] model layout, [L, B, H, S] cache layout
+std::shared_ptr<VariableStateKVcache> makeState(bool native_get_state, int64_t heads = 2) {
+    const Shape shape(ov::PartialShape{-1, heads, -1, 4});
+    auto external_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, shape);
+    auto internal_desc = ArbitraryOrderDescCreator({2, 0, 1, 3}).createSharedDesc(ov::element::f32, shape);
+    return std::make_shared<VariableStateKVcache>("kv",
+                                                  external_desc,
+                                                  internal_desc,
+                                                  ov::Extensions::Cpu::CacheSpec{},
+                                                  native_get_state);
+}
+
+std::shared_ptr<Tensor> makeTensor() {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto mem =
+        std::make_shared<Memory>(eng, std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{1, 2, 3, 4}));
+    auto* data = mem->getDataAs<float>();
+    std::iota(data, data + 24, 0.F);
+    return std::make_shared<Tensor>(mem);
+}
+
+void expectEqual(const ov::SoPtr<ov::ITensor>& lhs, const ov::SoPtr<ov::ITensor>& rhs) {
+    ASSERT_EQ(lhs->get_shape(), rhs->get_shape());
+    const auto* lhsData = static_cast<const float*>(lhs->data());
+    const auto* rhsData = static_cast<const float*>(rhs->data());
+    for (size_t i = 0; i < lhs->get_size(); ++i) {
+        ASSERT_EQ(lhsData[i], rhsData[i]);
+    }
+}
+
+}  // namespace
+
+TEST(VariableStateKVcacheTest, NativeStateRoundTrip) {
+    auto source = makeState(true);
+    auto reference = makeTensor();
+    source->set_state(reference);
+
+    auto native = source->get_state();
+    ASSERT_NE(std::dynamic_pointer_cast<KVCacheNativeTensor>(native._ptr), nullptr);
+    ASSERT_EQ(native->get_element_type(), ov::element::u8);
+
+    // the native tensor is a snapshot, which may be set to several states sharing its memory until the first write
+    auto first = makeState(false);
+    auto second = makeState(false);
+    first->set_state(native);
+    second->set_state(native);
+    ASSERT_FALSE(first->is_reset_state());
+    ASSERT_NE(first->internal_state_mem()->getData(), source->internal_state_mem()->getData());
+    ASSERT_EQ(first->internal_state_mem()->getData(), second->internal_state_mem()->getData());
+    ASSERT_EQ(first->internal_state_max_size(), 0);
+    expectEqual(first->get_state(), reference);
+    expectEqual(second->get_state(), reference);
+}
+
+TEST(VariableStateKVcacheTest, ExportDetachHandsOverMemory) {
+    auto source = makeState(false);
+    source->set_state(makeTensor());
+    const auto cache = source->internal_state_mem();
+
+    auto copy = source->export_native_state(false);
+    ASSERT_NE(copy.internal_mem, cache);
+    ASSERT_FALSE(source->is_reset_state());
+
+    auto state = source->export_native_state(true);
+    ASSERT_EQ(state.internal_mem, cache);
+    ASSERT_TRUE(source->is_reset_state());
+    ASSERT_EQ(source->internal_state_mem(), nullptr);
+    ASSERT_EQ(source->internal_state_max_size(), 0);
+
+    auto target = makeState(false);
+    target->import_native_state(std::move(state));
+    ASSERT_FALSE(target->is_reset_state());
+    ASSERT_EQ(target->internal_state_mem(), cache);
+    expectEqual(target->get_state(), makeTensor());
+}
+
+TEST(VariableStateKVcacheTest, ImportChecksShape) {
+    auto source = makeState(false);
+    source->set_state(makeTensor());
+
+    // the same layout, but another number of heads
+    auto target = makeState(false, 3);
+    ASSERT_THROW(target->import_native_state(source->export_native_state(false)), ov::Exception);
+    auto nativeSource = makeState(true);
+    nativeSource->set_state(makeTensor());
+    ASSERT_THROW(target->set_state(nativeSource->get_state()), ov::Exception);
+
+    auto state = source->export_native_state(false);
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    state.hidden_state =
+        std::make_shared<Memory>(eng, std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32, Shape{1, 2}));
+    ASSERT_THROW(makeState(false)->import_native_state(std::move(state)), ov::Exception);
+}
+
+TEST(VariableStateKVcacheTest, ForkSharesPrefix) {
+    auto source = makeState(false);
+    source->set_state(makeTensor());
+    const auto max_size = source->internal_state_max_size();
+    ASSERT_GT(max_size, 0);
+
+    auto fork = makeState(false);
+    fork->fork_from(*source, 2);
+    ASSERT_FALSE(fork->is_reset_state());
+    ASSERT_EQ(fork->internal_state_mem()->getData(), source->internal_state_mem()->getData());
+
+    // only the fork copies the memory on the first write, the source keeps appending to it, the beam table is copied
+    ASSERT_EQ(source->internal_state_max_size(), max_size);
+    ASSERT_GT(source->hidden_state_max_size(), 0);
+    ASSERT_EQ(fork->internal_state_max_size(), 0);
+    ASSERT_NE(fork->hidden_state_mem()->getData(), source->hidden_state_mem()->getData());
+
+    // [1, 2, 3, 4] -> [1, 2, 2, 4]
+    auto state = fork->get_state();
+    ASSERT_EQ(state->get_shape(), ov::Shape({1, 2, 2, 4}));
+    const auto* data = static_cast<const float*>(state->data());
+    for (size_t h = 0; h < 2; ++h) {
+        for (size_t i = 0; i < 8; ++i) {
+            ASSERT_EQ(data[h * 8 + i], static_cast<float>(h * 12 + i));
+        }
+    }
+
+    fork->assign_internal_state(fork->internal_state_mem());
+    ASSERT_EQ(fork->internal_state_max_size(), max_size);
+    ASSERT_THROW(makeState(false)->fork_from(*source, 4), ov::Exception);
+
+    // the source overwriting the shared tokens in place copies the memory first
+    source->trim(2);
+    ASSERT_EQ(source->internal_state_max_size(), max_size);
+    source->trim(1);
+    ASSERT_EQ(source->internal_state_max_size(), 0);
+    auto resetSource = makeState(false);
+    resetSource->set_state(makeTensor());
+    makeState(false)->fork_from(*resetSource, 1);
+    resetSource->reset();
+    ASSERT_EQ(resetSource->internal_state_max_size(), 0);
+}
+
+TEST(VariableStateKVcacheTest, TrimDropsTokens) {
+    auto state = makeState(false);
+    state->set_state(makeTensor());
+    const auto* cache = state->internal_state_mem()->getData();
+
+    state->trim(2);
+    ASSERT_FALSE(state->is_reset_state());
+    // the memory is kept, the next inference overwrites the dropped tokens
+    ASSERT_EQ(state->internal_state_mem()->getData(), cache);
+
+    // [1, 2, 3, 4] -> [1, 2, 2, 4]
+    auto trimmed = state->get_state();
+    ASSERT_EQ(trimmed->get_shape(), ov::Shape({1, 2, 2, 4}));
+    const auto* data = static_cast<const float*>(trimmed->data());
+    for (size_t h = 0; h < 2; ++h) {
+        for (size_t i = 0; i < 8; ++i) {
+            ASSERT_EQ(data[h * 8 + i], static_cast<float>(h * 12 + i));
+        }
+    }
+
+    ASSERT_THROW(state->trim(4), ov::Exception);
+    state->trim(0);
+    ASSERT_TRUE(state->is_reset_state());
+}
@@ -0,0 +1,113 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <oneapi/dnnl/dnnl.hpp>
+#include <vector>
+
+#include "cpu_parallel.hpp"
+#include "nodes/kernels/multi_lora.hpp"
+#include "openvino/core/type/element_type.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+constexpr size_t batch = 4;
+constexpr size_t rows = 2;
+constexpr size_t K = 8;
+// isn't a multiple of the vector length
+constexpr size_t N = 70;
+
+class MultiLoraTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto fill = [](std::vector<float>& data, size_t size, float scale) {
+            data.resize(size);
+            for (size_t i = 0; i < size; i++) {
+                data[i] = static_cast<float>(static_cast<int>(i % 7) - 3) * scale;
+            }
+        };
+        fill(main, batch * rows * N, 1.F);
+        fill(x, batch * rows * K, 0.5F);
+        fill(a, rank * K, 0.25F);
+        fill(alpha, rank, 2.F);
+        fill(b, N * rank, 0.125F);
+    }
+
+    // the adapter applied to each batch element separately
+    std::vector<float> reference() const {
+        std::vector<float> result = main;
+        for (size_t i = 0; i < batch; i++) {
+            if (ids[i] < 0) {
+                continue;
+            }
+            const size_t begin = offsets[ids[i]];
+            const size_t end = offsets[ids[i] + 1];
+            for (size_t r = 0; r < rows; r++) {
+                const size_t row = i * rows + r;
+                for (size_t n = 0; n < N; n++) {
+                    for (size_t j = begin; j < end; j++) {
+                        float low_rank = 0.F;
+                        for (size_t k = 0; k < K; k++) {
+                            low_rank += x[row * K + k] * a[j * K + k];
+                        }
+                        result[row * N + n] += low_rank * alpha[j] * b[n * rank + j];
+                    }
+                }
+            }
+        }
+        return result;
+    }
+
+    void run(const float* src, float* dst) {
+        dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+        dnnl::stream strm(eng);
+        MultiLoRA(eng, ov::element::f32)
+            .execute(strm,
+                     src,
+                     x.data(),
+                     a.data(),
+                     alpha.data(),
+                     b.data(),
+                     dst,
+                     rows,
+                     K,
+                     N,
+                     rank,
+                     offsets,
+                     ids,
+                     std::make_shared<CpuParallel>(ov::intel_cpu::TbbPartitioner::STATIC));
+    }
+
+    // two adapters of the ranks 2 and 3, the rows of the first and the last batch elements are bucketed into one GEMM,
+    // the second batch element uses the base model only
+    static constexpr size_t rank = 5;
+    const std::vector<size_t> offsets{0, 2, 5};
+    const std::vector<int32_t> ids{1, -1, 0, 1};
+    std::vector<float> main, x, a, alpha, b;
+};
+
+}  // namespace
+
+TEST_F(MultiLoraTest, AppliesAdapterPerBatchElement) {
+    std::vector<float> dst(main.size());
+    run(main.data(), dst.data());
+    const auto expected = reference();
+    for (size_t i = 0; i < dst.size(); i++) {
+        ASSERT_NEAR(dst[i], expected[i], 1e-4F) << "element " << i;
+    }
+}
+
+TEST_F(MultiLoraTest, InPlace) {
+    const auto expected = reference();
+    run(main.data(), main.data());
+    for (size_t i = 0; i < main.size(); i++) {
+        ASSERT_NEAR(main[i], expected[i], 1e-4F) << "element " << i;
+    }
+}
@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "openvino/runtime/aligned_buffer.hpp"
+#include "openvino/runtime/shared_buffer.hpp"
+#include "utils/graph_serializer/repacked_weights.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+MemoryPtr makeMemory(const dnnl::engine& eng, size_t size, float start) {
+    auto memory = std::make_shared<Memory>(eng, std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{size}));
+    auto* data = memory->getDataAs<float>();
+    std::iota(data, data + size, start);
+    return memory;
+}
+
+}  // namespace
+
+TEST(RepackedWeightsSectionTest, WriteAndRead) {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    const RepackedWeightsSection::Records records{{"first", makeMemory(eng, 3, 0.F)},
+                                                  {"second", makeMemory(eng, 16, 100.F)}};
+
+    // the section follows the model in the blob, so it starts at an arbitrary position
+    const std::string model = "model";
+    std::stringstream stream;
+    stream << model;
+    RepackedWeightsSection::write(stream, 42, records);
+    const auto blob = stream.str();
+
+    const auto sectionSize = RepackedWeightsSection::size(blob.data(), blob.size());
+    ASSERT_EQ(sectionSize, blob.size() - model.size());
+    ASSERT_EQ(RepackedWeightsSection::size(stream, blob.size()), sectionSize);
+    ASSERT_EQ(RepackedWeightsSection::size(model.data(), model.size()), 0);
+
+    // the blob mapped into the memory
+    auto buffer = std::make_shared<ov::AlignedBuffer>(blob.size(), RepackedWeightsSection::dataAlignment);
+    std::memcpy(buffer->get_ptr(), blob.data(), blob.size());
+    auto section = std::make_shared<ov::SharedBuffer<std::shared_ptr<ov::AlignedBuffer>>>(
+        buffer->get_ptr<char>() + model.size(),
+        sectionSize,
+        buffer);
+
+    uint64_t id = 0;
+    const auto loaded = RepackedWeightsSection::read(section, eng, id);
+    ASSERT_EQ(id, 42);
+    ASSERT_EQ(loaded.size(), records.size());
+    for (size_t i = 0; i < records.size(); i++) {
+        ASSERT_EQ(loaded[i].first, records[i].first);
+        ASSERT_TRUE(loaded[i].second->getDesc().isCompatible(records[i].second->getDesc()));
+        ASSERT_EQ(loaded[i].second->getSize(), records[i].second->getSize());
+        ASSERT_EQ(std::memcmp(loaded[i].second->getData(), records[i].second->getData(), records[i].second->getSize()),
+                  0);
+        // the records are aliased, not copied
+        const auto* data = static_cast<const char*>(loaded[i].second->getData());
+        ASSERT_GE(data, section->get_ptr<const char>());
+        ASSERT_LT(data, section->get_ptr<const char>() + sectionSize);
+    }
+}
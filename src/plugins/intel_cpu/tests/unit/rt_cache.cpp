@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include "cache/clock_cache.h"
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
 #include "common_test_utils/test_assertions.hpp"
@@ -97,6 +98,124 @@ TEST(LruCacheTests, Empty) {
         ASSERT_EQ(cache.get({i}), int());
     }
 }
+TEST(ClockCacheTests, Evict) {
+    constexpr size_t capacity = 10;
+    ClockCache<IntKey, int> cache(capacity);
+    for (size_t i = 0; i < 2 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({10}, 10));
+    }
+    ASSERT_EQ(cache.size(), 1);
+    OV_ASSERT_NO_THROW(cache.evict(5));
+    OV_ASSERT_NO_THROW(cache.evict(10));
+    int result = cache.get({10});
+    ASSERT_EQ(result, int());
+    ASSERT_EQ(cache.size(), 0);
+    ASSERT_EQ(cache.getEvictions(), 1);
+    OV_ASSERT_NO_THROW(cache.evict(0));
+}
+
+TEST(ClockCacheTests, Get) {
+    constexpr int capacity = 10;
+    ClockCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < 2 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+    ASSERT_EQ(cache.getEvictions(), capacity - 1);
+}
+
+TEST(ClockCacheTests, SecondChancePolicy) {
+    constexpr int capacity = 10;
+    ClockCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    // referenced records survive the next sweep
+    for (int i = 0; i < capacity / 2; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+
+    for (int i = capacity; i < capacity + capacity / 2; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 0; i < capacity / 2; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+    for (int i = capacity / 2; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(ClockCacheTests, CollidingKeys) {
+    struct CollidingKey {
+        size_t hash() const {
+            return static_cast<size_t>(data % 3);
+        }
+        bool operator==(const CollidingKey& rhs) const noexcept {
+            return this->data == rhs.data;
+        }
+
+        int data;
+    };
+
+    constexpr int capacity = 8;
+    ClockCache<CollidingKey, int> cache(capacity);
+    for (int i = 0; i < 4 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+        ASSERT_EQ(cache.get({i}), i);
+    }
+    ASSERT_EQ(cache.size(), capacity);
+
+    size_t found = 0;
+    for (int i = 0; i < 4 * capacity; ++i) {
+        const auto value = cache.get({i});
+        if (value != int()) {
+            ASSERT_EQ(value, i);
+            ++found;
+        }
+    }
+    ASSERT_EQ(found, capacity);
+}
+
+TEST(ClockCacheTests, Sharded) {
+    constexpr int capacity = 1000;
+    ClockCache<IntKey, int> cache(capacity);
+    for (int i = 1; i <= capacity / 2; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    for (int i = 1; i <= capacity / 2; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+    for (int i = 1; i <= 10 * capacity; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    ASSERT_EQ(cache.size(), capacity);
+    ASSERT_EQ(cache.getEvictions(), 9 * capacity);
+}
+
+TEST(ClockCacheTests, Empty) {
+    constexpr size_t capacity = 0;
+    constexpr int attempts = 10;
+    ClockCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < attempts; ++i) {
+        OV_ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+    OV_ASSERT_NO_THROW(cache.evict(attempts));
+}
+
 namespace {
 template<typename T, typename K>
 class mockBuilder {
@@ -380,3 +499,40 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, ConcurrentStatistics) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 100;
+    constexpr int numKeys = 2 * capacity;
+    constexpr size_t numThreads = 8;
+    constexpr int iterations = 4;
+
+    auto intBuilder = [](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity, true);
+
+    auto testRoutine = [&]() {
+        for (int it = 0; it < iterations; ++it) {
+            for (int i = 0; i < numKeys; ++i) {
+                auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+                ASSERT_NE(intResult.first, IntValueType());
+                ASSERT_EQ(*intResult.first, i);
+            }
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    const auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits + stats.misses, numThreads * iterations * numKeys);
+    ASSERT_GE(stats.misses, static_cast<size_t>(numKeys));
+    ASSERT_EQ(stats.size, static_cast<size_t>(capacity));
+    ASSERT_LE(stats.evictions, stats.misses - stats.size);
+}
@@ -0,0 +1,106 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+
+#include "cache/runtime_cache_warmup.h"
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/file_utils.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+class RuntimeCacheWarmupTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        m_path = ov::test::utils::generateTestFilePrefix() + "_rt_cache_warmup.txt";
+    }
+
+    void TearDown() override {
+        ov::test::utils::removeFile(m_path);
+    }
+
+    std::string m_path;
+};
+
+}  // namespace
+
+TEST_F(RuntimeCacheWarmupTest, RecordToString) {
+    const RuntimeCacheWarmup::Record record{{1, 128}, {}, {2, 3, 4}};
+    const auto str = RuntimeCacheWarmup::toString(record);
+    ASSERT_EQ(str, "[1,128];[];[2,3,4]");
+
+    RuntimeCacheWarmup::Record parsed;
+    ASSERT_TRUE(RuntimeCacheWarmup::fromString(str, parsed));
+    ASSERT_EQ(parsed, record);
+
+    ASSERT_FALSE(RuntimeCacheWarmup::fromString("[1,a]", parsed));
+    ASSERT_FALSE(RuntimeCacheWarmup::fromString("1,2", parsed));
+    ASSERT_FALSE(RuntimeCacheWarmup::fromString("[1,2", parsed));
+}
+
+TEST_F(RuntimeCacheWarmupTest, SaveAndLoad) {
+    {
+        RuntimeCacheWarmup warmup(m_path, "model", 2);
+        ASSERT_TRUE(warmup.loadedRecords().empty());
+        warmup.record({{1, 16}, {1, 16}});
+        warmup.record({{1, 32}, {1, 32}});
+        warmup.record({{1, 16}, {1, 16}});
+        warmup.save();
+    }
+
+    {
+        RuntimeCacheWarmup warmup(m_path, "model", 2);
+        const RuntimeCacheWarmup::Record first{{1, 16}, {1, 16}};
+        const RuntimeCacheWarmup::Record second{{1, 32}, {1, 32}};
+        ASSERT_EQ(warmup.loadedRecords().size(), 2);
+        ASSERT_EQ(warmup.loadedRecords()[0], first);
+        ASSERT_EQ(warmup.loadedRecords()[1], second);
+        // known records do not make the file dirty
+        warmup.record(first);
+        warmup.record({{1, 64}, {1, 64}});
+        warmup.save();
+    }
+
+    RuntimeCacheWarmup warmup(m_path, "model", 2);
+    ASSERT_EQ(warmup.loadedRecords().size(), 3);
+}
+
+TEST_F(RuntimeCacheWarmupTest, IgnoreMismatchedFile) {
+    {
+        RuntimeCacheWarmup warmup(m_path, "model", 1);
+        warmup.record({{1, 16}});
+        warmup.save();
+    }
+
+    ASSERT_TRUE(RuntimeCacheWarmup(m_path, "another_model", 1).loadedRecords().empty());
+    ASSERT_TRUE(RuntimeCacheWarmup(m_path, "model", 2).loadedRecords().empty());
+    ASSERT_EQ(RuntimeCacheWarmup(m_path, "model", 1).loadedRecords().size(), 1);
+}
+
+TEST_F(RuntimeCacheWarmupTest, SkipBrokenRecords) {
+    {
+        std::ofstream file(m_path);
+        file << "OV_CPU_RUNTIME_CACHE_WARMUP 1\nmodel\n1\n[1,16]\n[1,x]\n[1,16];[2]\n[4]\n";
+    }
+
+    RuntimeCacheWarmup warmup(m_path, "model", 1);
+    ASSERT_EQ(warmup.loadedRecords().size(), 2);
+}
+
+TEST_F(RuntimeCacheWarmupTest, MaxRecords) {
+    RuntimeCacheWarmup warmup(m_path, "model", 1);
+    for (size_t i = 0; i < 2 * RuntimeCacheWarmup::maxRecords; ++i) {
+        ASSERT_EQ(warmup.isFull(), i >= RuntimeCacheWarmup::maxRecords);
+        warmup.record({{1, i}});
+    }
+    warmup.save();
+
+    ASSERT_EQ(RuntimeCacheWarmup(m_path, "model", 1).loadedRecords().size(), RuntimeCacheWarmup::maxRecords);
+    ASSERT_TRUE(RuntimeCacheWarmup(m_path, "model", 1).isFull());
+}
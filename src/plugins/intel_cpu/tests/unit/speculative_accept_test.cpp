@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "cpu_parallel.hpp"
+#include "nodes/kernels/speculative_accept.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+constexpr size_t vocabSize = 5;
+
+class SpeculativeAcceptTest : public ::testing::Test {
+protected:
+    // appends a row with all the probability at the token
+    void addRow(std::vector<float>& probs, int32_t token) {
+        std::vector<float> row(vocabSize, 0.F);
+        row[token] = 1.F;
+        probs.insert(probs.end(), row.begin(), row.end());
+    }
+
+    void run(const std::vector<float>& probs,
+             const std::vector<int32_t>& draft,
+             const std::vector<float>& draftProbs,
+             size_t batch,
+             bool greedy) {
+        const size_t draftLen = draft.size() / batch;
+        tokens.assign(batch * (draftLen + 1), 0);
+        accepted.assign(batch, 0);
+        speculative_accept(probs.data(),
+                           draft.data(),
+                           draftProbs.empty() ? nullptr : draftProbs.data(),
+                           tokens.data(),
+                           accepted.data(),
+                           batch,
+                           draftLen,
+                           vocabSize,
+                           greedy,
+                           42,
+                           std::make_shared<CpuParallel>(ov::intel_cpu::TbbPartitioner::STATIC));
+    }
+
+    std::vector<int32_t> tokens;
+    std::vector<int32_t> accepted;
+};
+
+}  // namespace
+
+TEST_F(SpeculativeAcceptTest, GreedyStopsAtFirstMismatch) {
+    std::vector<float> probs;
+    // batch 0 matches the whole draft, batch 1 diverges at the second token
+    for (const int32_t token : {1, 2, 3, 4, 1, 0, 3, 4}) {
+        addRow(probs, token);
+    }
+    run(probs, {1, 2, 3, 1, 2, 3}, {}, 2, true);
+    ASSERT_EQ(accepted, std::vector<int32_t>({3, 1}));
+    ASSERT_EQ(tokens, std::vector<int32_t>({1, 2, 3, 4, 1, 0, -1, -1}));
+}
+
+TEST_F(SpeculativeAcceptTest, CertainDraftIsAccepted) {
+    std::vector<float> probs;
+    for (const int32_t token : {1, 2, 3}) {
+        addRow(probs, token);
+    }
+    run(probs, {1, 2}, {}, 1, false);
+    ASSERT_EQ(accepted, std::vector<int32_t>({2}));
+    ASSERT_EQ(tokens, std::vector<int32_t>({1, 2, 3}));
+}
+
+TEST_F(SpeculativeAcceptTest, ImpossibleDraftIsReplacedFromResidual) {
+    std::vector<float> probs;
+    for (const int32_t token : {1, 2, 3}) {
+        addRow(probs, token);
+    }
+    // the second draft token has zero target probability
+    run(probs, {1, 4}, {}, 1, false);
+    ASSERT_EQ(accepted, std::vector<int32_t>({1}));
+    ASSERT_EQ(tokens, std::vector<int32_t>({1, 2, -1}));
+}
+
+TEST_F(SpeculativeAcceptTest, DraftProbabilitiesShapeResidual) {
+    // the target is uniform over {0, 1}, the draft is certain about 1, each batch draws its own random numbers
+    constexpr size_t batch = 16;
+    std::vector<float> probs;
+    std::vector<float> draftProbs;
+    for (size_t b = 0; b < batch; b++) {
+        probs.insert(probs.end(), {0.5F, 0.5F, 0.F, 0.F, 0.F, 0.F, 0.F, 0.F, 0.F, 1.F});
+        draftProbs.insert(draftProbs.end(), {0.F, 1.F, 0.F, 0.F, 0.F});
+    }
+    run(probs, std::vector<int32_t>(batch, 1), draftProbs, batch, false);
+    for (size_t b = 0; b < batch; b++) {
+        if (accepted[b] == 1) {
+            ASSERT_EQ(tokens[b * 2], 1);
+            ASSERT_EQ(tokens[b * 2 + 1], 4);
+        } else {
+            // max(0, p - q) leaves only the token 0
+            ASSERT_EQ(accepted[b], 0);
+            ASSERT_EQ(tokens[b * 2], 0);
+            ASSERT_EQ(tokens[b * 2 + 1], -1);
+        }
+    }
+}
@@ -0,0 +1,224 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+MemoryPtr makeMemory() {
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    return std::make_shared<Memory>(eng, std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{4}));
+}
+
+MemoryPtr makeFilledMemory(float value) {
+    auto memory = makeMemory();
+    std::fill_n(static_cast<float*>(memory->getData()), 4, value);
+    return memory;
+}
+
+}  // namespace
+
+TEST(WeightsSharingTest, FindOrCreate) {
+    WeightsSharing cache;
+    size_t created = 0;
+    auto create = [&]() {
+        ++created;
+        return makeMemory();
+    };
+
+    auto first = MemoryPtr(*cache.findOrCreate("key", create));
+    auto second = MemoryPtr(*cache.findOrCreate("key", create));
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(created, 1);
+    ASSERT_EQ(MemoryPtr(*cache.get("key")), first);
+
+    // the cache doesn't own the objects, so an expired one is created again
+    first.reset();
+    second.reset();
+    auto third = MemoryPtr(*cache.findOrCreate("key", create));
+    ASSERT_NE(third, nullptr);
+    ASSERT_EQ(created, 2);
+}
+
+TEST(WeightsSharingTest, FailedCreationIsNotCached) {
+    WeightsSharing cache;
+    ASSERT_THROW(cache.findOrCreate("key",
+                                    []() -> MemoryPtr {
+                                        throw std::runtime_error("creation failed");
+                                    }),
+                 std::runtime_error);
+    auto memory = MemoryPtr(*cache.findOrCreate("key", makeMemory));
+    ASSERT_NE(memory, nullptr);
+}
+
+TEST(WeightsSharingTest, ConcurrentCreation) {
+    constexpr size_t numThreads = 8;
+    constexpr size_t numKeys = 4;
+    WeightsSharing cache;
+    std::atomic<size_t> created{0};
+    std::atomic<size_t> inProgress{0};
+    std::atomic<size_t> maxInProgress{0};
+
+    auto create = [&]() {
+        const size_t current = ++inProgress;
+        size_t prevMax = maxInProgress.load();
+        while (current > prevMax && !maxInProgress.compare_exchange_weak(prevMax, current)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        ++created;
+        --inProgress;
+        return makeMemory();
+    };
+
+    std::vector<std::vector<MemoryPtr>> results(numThreads);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numThreads; ++i) {
+        threads.emplace_back([&, i]() {
+            for (size_t k = 0; k < numKeys; ++k) {
+                const auto key = std::to_string((i + k) % numKeys);
+                results[i].push_back(MemoryPtr(*cache.findOrCreate(key, create)));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // each object is created exactly once, while the distinct objects may be created concurrently
+    ASSERT_EQ(created, numKeys);
+    ASSERT_GT(maxInProgress, 1);
+    for (size_t i = 0; i < numThreads; ++i) {
+        for (size_t k = 0; k < numKeys; ++k) {
+            ASSERT_EQ(results[i][k], MemoryPtr(*cache.get(std::to_string((i + k) % numKeys))));
+        }
+    }
+}
+
+TEST(WeightsSharingTest, InvalidObjectIsLocked) {
+    WeightsSharing cache;
+    auto owner = cache.findOrCreate("key", makeMemory, false);
+    ASSERT_FALSE(owner->isValid());
+
+    std::atomic<bool> acquired{false};
+    std::thread reader([&]() {
+        auto shared = cache.get("key");
+        acquired = true;
+        ASSERT_TRUE(shared->isValid());
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    ASSERT_FALSE(acquired);
+    owner->valid(true);
+    owner.reset();
+    reader.join();
+    ASSERT_TRUE(acquired);
+}
+
+TEST(WeightsSharingTest, ProcessWideSharing) {
+    // the same weights loaded by two compiled models
+    auto weights = makeFilledMemory(1.F);
+    auto weightsCopy = makeFilledMemory(1.F);
+    auto otherWeights = makeFilledMemory(2.F);
+
+    SocketsWeights firstModel(true);
+    SocketsWeights secondModel(true);
+    const auto key = firstModel[0]->weightsKey(weights);
+    ASSERT_EQ(key, secondModel[0]->weightsKey(weightsCopy));
+    ASSERT_NE(key, secondModel[0]->weightsKey(otherWeights));
+
+    // the same bytes of another type or shape are different weights
+    dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto asInt = std::make_shared<Memory>(eng, std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32, Shape{4}));
+    auto reshaped =
+        std::make_shared<Memory>(eng, std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{2, 2}));
+    std::memcpy(asInt->getData(), weights->getData(), weights->getSize());
+    std::memcpy(reshaped->getData(), weights->getData(), weights->getSize());
+    ASSERT_NE(key, secondModel[0]->weightsKey(asInt));
+    ASSERT_NE(key, secondModel[0]->weightsKey(reshaped));
+
+    size_t created = 0;
+    auto create = [&]() {
+        ++created;
+        return makeMemory();
+    };
+    auto first = MemoryPtr(*firstModel[0]->findOrCreateShared(key, create));
+    auto second = MemoryPtr(*secondModel[0]->findOrCreateShared(key, create));
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(created, 1);
+
+    // the models not using the process wide cache don't share anything
+    SocketsWeights localModel;
+    ASSERT_NE(localModel[0]->weightsKey(weights), localModel[0]->weightsKey(weightsCopy));
+    auto local = MemoryPtr(*localModel[0]->findOrCreateShared(key, create));
+    ASSERT_NE(local, first);
+    ASSERT_EQ(created, 2);
+}
+
+TEST(WeightsSharingTest, SharedObjects) {
+    auto weights = makeFilledMemory(1.F);
+
+    // the objects derived from the weights aren't shared by the models not using the process wide cache
+    SocketsWeights firstModel;
+    SocketsWeights secondModel;
+    const auto key = firstModel[0]->weightsKey(weights);
+    ASSERT_EQ(key, secondModel[0]->weightsKey(weights));
+
+    auto repacked = MemoryPtr(*firstModel[0]->findOrCreateShared(key, makeMemory));
+    auto other = MemoryPtr(*firstModel[0]->findOrCreate("other", makeMemory));
+    ASSERT_NE(MemoryPtr(*secondModel[0]->findOrCreateShared(key, makeMemory)), repacked);
+
+    // only the objects created through findOrCreateShared() and still alive are reported
+    auto objects = firstModel[0]->sharedObjects();
+    ASSERT_EQ(objects.size(), 1);
+    ASSERT_EQ(objects[0].first, key);
+    ASSERT_EQ(objects[0].second, repacked);
+
+    objects.clear();
+    repacked.reset();
+    ASSERT_TRUE(firstModel[0]->sharedObjects().empty());
+}
+
+TEST(WeightsSharingTest, OffsetKeys) {
+    auto weights = makeFilledMemory(1.F);
+
+    // the compiled model exports the object derived from the weights with the key based on the offset of their data
+    SocketsWeights compiledModel;
+    const auto key = "node_0_" + compiledModel[0]->weightsKey(weights);
+    auto repacked = MemoryPtr(*compiledModel[0]->findOrCreateShared(key, makeMemory));
+    const auto objects = compiledModel[0]->sharedObjects(7, ConstantOffsets{{weights->getData(), 64}});
+    ASSERT_EQ(objects.size(), 1);
+    ASSERT_EQ(objects[0].second, repacked);
+    ASSERT_NE(objects[0].first, key);
+
+    // the imported model identifies the weights by the offset, not by the address or the content (which differ here)
+    auto imported = makeFilledMemory(2.F);
+    const auto offsets = std::make_shared<ConstantOffsets>(ConstantOffsets{{imported->getData(), 64}});
+    SocketsWeights importedModel;
+    importedModel[0]->setWeightsOffsets(7, offsets);
+    ASSERT_EQ(objects[0].first, "node_0_" + importedModel[0]->weightsKey(imported));
+
+    // the same offset in another blob is other weights
+    SocketsWeights otherModel;
+    otherModel[0]->setWeightsOffsets(8, offsets);
+    ASSERT_NE(objects[0].first, "node_0_" + otherModel[0]->weightsKey(imported));
+
+    // the weights with unknown offsets keep the address based keys
+    ASSERT_EQ(compiledModel[0]->sharedObjects(7, ConstantOffsets{})[0].first, key);
+}
@@ -30,6 +30,14 @@ public:
 
     void set_callback(std::function<void(std::exception_ptr)> callback) override;
 
+    void set_priority(ov::hint::Priority priority) override;
+
+    ov::hint::Priority get_priority() const override;
+
+    void fork_states(const std::shared_ptr<ov::IAsyncInferRequest>& source, size_t position) override;
+
+    void trim_states(size_t position) override;
+
     void infer() override;
 
     std::vector<ov::ProfilingInfo> get_profiling_info() const override;
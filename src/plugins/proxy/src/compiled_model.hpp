@@ -43,6 +43,9 @@ public:
             property._so = m_compiled_model._so;
         return property;
     }
+    std::shared_ptr<ov::LatencyHistograms> get_latency_histograms() const override {
+        return m_compiled_model->get_latency_histograms();
+    }
     const std::vector<ov::Output<const ov::Node>>& inputs() const override {
         return m_compiled_model->inputs();
     }
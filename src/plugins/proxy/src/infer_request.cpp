@@ -39,6 +39,24 @@ void ov::proxy::InferRequest::set_callback(std::function<void(std::exception_ptr
     m_infer_request->set_callback(callback);
 }
 
+void ov::proxy::InferRequest::set_priority(ov::hint::Priority priority) {
+    m_infer_request->set_priority(priority);
+}
+
+ov::hint::Priority ov::proxy::InferRequest::get_priority() const {
+    return m_infer_request->get_priority();
+}
+
+void ov::proxy::InferRequest::fork_states(const std::shared_ptr<ov::IAsyncInferRequest>& source, size_t position) {
+    // the hardware request forks the states of the hardware request behind the source proxy
+    auto proxy_source = std::dynamic_pointer_cast<ov::proxy::InferRequest>(source);
+    m_infer_request->fork_states(proxy_source ? proxy_source->get_hardware_request()._ptr : source, position);
+}
+
+void ov::proxy::InferRequest::trim_states(size_t position) {
+    m_infer_request->trim_states(position);
+}
+
 void ov::proxy::InferRequest::infer() {
     m_infer_request->infer();
 }